@@ -22,18 +22,26 @@
 #include "aztec3/circuits/abis/signed_tx_request.hpp"
 #include "aztec3/circuits/abis/types.hpp"
 #include "aztec3/circuits/hash.hpp"
+#include "aztec3/circuits/vk_hash_cache.hpp"
 #include "aztec3/constants.hpp"
+#include "aztec3/utils/field_serialization.hpp"
+#include "aztec3/utils/hash_tables.hpp"
 #include "aztec3/utils/types/native_types.hpp"
 
 #include <barretenberg/barretenberg.hpp>
+#include <barretenberg/common/thread.hpp>
 
 namespace {
 
 using aztec3::circuits::compute_constructor_hash;
 using aztec3::circuits::compute_contract_address;
+using aztec3::circuits::compute_empty_subtree_roots;
+using aztec3::circuits::compute_sparse_tree;
+using aztec3::circuits::compute_sparse_tree_root;
 using aztec3::circuits::abis::CallStackItem;
 using aztec3::circuits::abis::FunctionData;
 using aztec3::circuits::abis::FunctionLeafPreimage;
+using aztec3::circuits::abis::KernelCircuitPublicInputs;
 using aztec3::circuits::abis::NewContractData;
 using aztec3::circuits::abis::SignedTxRequest;
 using aztec3::circuits::abis::TxContext;
@@ -44,27 +52,52 @@ using aztec3::circuits::abis::PublicTypes;
 // Cbind helper functions
 
 /**
- * @brief Fill in zero-leaves to get a full tree's bottom layer.
+ * @brief The roots of the empty function subtrees of every height, computed on first use.
  *
- * @details Given the a vector of nonzero leaves starting at the left,
- * append zeroleaves to that list until it represents a FULL set of leaves
- * for a tree of the given height.
- * **MODIFIES THE INPUT `leaves` REFERENCE!**
+ * @details Entry 0 is the hash of an empty/0 function leaf preimage. These fill in every function tree node which
+ * has no nonempty leaf below it, so that only the nodes above the contract's functions need hashing.
+ */
+std::array<NT::fr, aztec3::FUNCTION_TREE_HEIGHT + 1> const& get_empty_function_subtree_roots()
+{
+    static auto const empty_subtree_roots =
+        compute_empty_subtree_roots<NT, aztec3::FUNCTION_TREE_HEIGHT>(FunctionLeafPreimage<NT>().hash());
+    return empty_subtree_roots;
+}
+
+NT::fr compute_message_secret_hash(NT::fr const& message_secret)
+{
+    // TODO(sean): This is not using the generator correctly and is unsafe, update
+    return crypto::pedersen_commitment::compress_native(
+        { aztec3::GeneratorIndex::L1_TO_L2_MESSAGE_SECRET, message_secret });
+}
+
+/**
+ * @brief Hashes every item of a serialized, length-prefixed vector of `T`s, writing the hashes back to back
  *
- * @tparam TREE_HEIGHT height of the tree used to determine max leaves
- * @param leaves the nonzero leaves of the tree starting at the left
- * @param zero_leaf the leaf value to be used for any empty/unset leaves
+ * @details The batched counterpart of the c_binds hashing one object per call: a single WASM call hashes a whole
+ * block's worth of items. The items are spread over barretenberg's thread pool, which runs them sequentially when
+ * built without MULTITHREADING (e.g. WASM). Every hashing table is built (see `init_hash_tables`) before any worker
+ * thread runs, as items may hash with different generators.
+ *
+ * @tparam T the type of the items
+ * @param items_buf a length-prefixed vector of serialized `T`s
+ * @param output buffer with room for one serialized `fr` per item, in which the hashes are written in input order
+ * @param hash the hash of one item, a callable `NT::fr(T const&)`
  */
-template <size_t TREE_HEIGHT> void rightfill_with_zeroleaves(std::vector<NT::fr>& leaves, NT::fr& zero_leaf)
+template <typename T, typename Hash> void hash_batch(uint8_t const* items_buf, uint8_t* output, Hash const& hash)
 {
-    constexpr size_t max_leaves = 2 << (TREE_HEIGHT - 1);
-    // input cant exceed max leaves
-    // FIXME don't think asserts will show in wasm
-    ASSERT(leaves.size() <= max_leaves);
+    std::vector<T> items;
+    read(items_buf, items);
+    if (items.empty()) {
+        return;
+    }
+
+    aztec3::utils::init_hash_tables();
 
-    // fill in input vector with zero-leaves
-    // to get a full bottom layer of the tree
-    leaves.insert(leaves.end(), max_leaves - leaves.size(), zero_leaf);
+    auto hash_item = [&](size_t i) {
+        NT::fr::serialize_to_buffer(hash(items[i]), output + i * aztec3::utils::FIELD_SERIALIZED_SIZE);
+    };
+    parallel_for(items.size(), hash_item);
 }
 
 }  // namespace
@@ -172,11 +205,20 @@ WASM_EXPORT void abis__compute_function_selector(char const* func_sig_cstr, uint
 WASM_EXPORT void abis__hash_vk(uint8_t const* vk_data_buf, uint8_t* output)
 {
     NT::VKData vk_data;
-    read(vk_data_buf, vk_data);
+    uint8_t const* vk_data_end = vk_data_buf;
+    read(vk_data_end, vk_data);
 
-    NT::fr::serialize_to_buffer(vk_data.compress_native(aztec3::GeneratorIndex::VK), output);
+    // the consumed input bytes are the serialized vk data, so they key the vk hash cache as they are
+    auto const vk_hash = aztec3::circuits::compress_vk_data_native(
+        vk_data, vk_data_buf, static_cast<size_t>(vk_data_end - vk_data_buf));
+    NT::fr::serialize_to_buffer(vk_hash, output);
 }
 
+/**
+ * @brief The hit/miss counters of the process-wide vk hash cache (shared by `abis__hash_vk` and the private kernel).
+ */
+CBIND(abis__get_vk_hash_cache_stats, aztec3::circuits::get_vk_hash_cache_stats);
+
 /**
  * @brief Generates a function tree leaf from its preimage.
  * This is a WASM-export that can be called from Typescript.
@@ -204,6 +246,8 @@ WASM_EXPORT void abis__compute_function_leaf(uint8_t const* function_leaf_preima
  * @details given a serialized vector of nonzero function leaves,
  * compute the corresponding tree's root and return the
  * serialized results via `root_out` buffer.
+ * Empty subtrees are not rehashed (see `compute_sparse_tree_root`), so the cost
+ * grows with the number of functions rather than the size of the tree.
  *
  * @param function_leaves_in input buffer representing a serialized vector of
  * nonzero function leaves where each leaf is an `fr` starting at the left of the tree
@@ -212,14 +256,11 @@ WASM_EXPORT void abis__compute_function_leaf(uint8_t const* function_leaf_preima
 WASM_EXPORT void abis__compute_function_tree_root(uint8_t const* function_leaves_in, uint8_t* root_out)
 {
     std::vector<NT::fr> leaves;
-    // fill in nonzero leaves to start
     read(function_leaves_in, leaves);
-    // fill in zero leaves to complete tree
-    NT::fr zero_leaf = FunctionLeafPreimage<NT>().hash();  // hash of empty/0 preimage
-    rightfill_with_zeroleaves<aztec3::FUNCTION_TREE_HEIGHT>(leaves, zero_leaf);
 
-    // compute the root of this complete tree, return
-    NT::fr const root = plonk::stdlib::merkle_tree::compute_tree_root_native(leaves);
+    // compute the root, hashing only the nodes above the nonzero leaves
+    NT::fr const root =
+        compute_sparse_tree_root<NT, aztec3::FUNCTION_TREE_HEIGHT>(leaves, get_empty_function_subtree_roots());
 
     // serialize and return root
     NT::fr::serialize_to_buffer(root, root_out);
@@ -232,6 +273,8 @@ WASM_EXPORT void abis__compute_function_tree_root(uint8_t const* function_leaves
  * @details given a serialized vector of nonzero function leaves,
  * compute ALL of the corresponding tree's nodes (including root) and return
  * the serialized results via `tree_nodes_out` buffer.
+ * Empty subtrees are not rehashed (see `compute_sparse_tree`), so the hashing
+ * grows with the number of functions rather than the size of the tree.
  *
  * @param function_leaves_in input buffer representing a serialized vector of
  * nonzero function leaves where each leaf is an `fr` starting at the left of the tree.
@@ -241,13 +284,11 @@ WASM_EXPORT void abis__compute_function_tree_root(uint8_t const* function_leaves
 WASM_EXPORT void abis__compute_function_tree(uint8_t const* function_leaves_in, uint8_t* tree_nodes_out)
 {
     std::vector<NT::fr> leaves;
-    // fill in nonzero leaves to start
     read(function_leaves_in, leaves);
-    // fill in zero leaves to complete tree
-    NT::fr zero_leaf = FunctionLeafPreimage<NT>().hash();  // hash of empty/0 preimage
-    rightfill_with_zeroleaves<aztec3::FUNCTION_TREE_HEIGHT>(leaves, zero_leaf);
 
-    std::vector<NT::fr> const tree = plonk::stdlib::merkle_tree::compute_tree_native(leaves);
+    // compute all nodes, hashing only those above the nonzero leaves
+    std::vector<NT::fr> const tree =
+        compute_sparse_tree<NT, aztec3::FUNCTION_TREE_HEIGHT>(leaves, get_empty_function_subtree_roots());
 
     // serialize and return tree
     write(tree_nodes_out, tree);
@@ -362,10 +403,109 @@ WASM_EXPORT void abis__compute_message_secret_hash(uint8_t const* secret, uint8_
 {
     NT::fr message_secret;
     read(secret, message_secret);
-    // TODO(sean): This is not using the generator correctly and is unsafe, update
-    auto secret_hash = crypto::pedersen_commitment::compress_native(
-        { aztec3::GeneratorIndex::L1_TO_L2_MESSAGE_SECRET, message_secret });
-    NT::fr::serialize_to_buffer(secret_hash, output);
+    NT::fr::serialize_to_buffer(compute_message_secret_hash(message_secret), output);
+}
+
+/**
+ * @brief Builds every table the hashing c_binds need up front, so that the first of them runs at steady-state speed
+ *
+ * @details Meant to be called once, as the module is instantiated. See `init_hash_tables`, which this extends with
+ * the empty function subtree roots.
+ */
+WASM_EXPORT void abis__init_hash_tables()
+{
+    aztec3::utils::init_hash_tables();
+    get_empty_function_subtree_roots();
+}
+
+/* Batched versions of the hashing c_binds above, see `hash_batch`.
+ * Each takes a length-prefixed vector of the objects its single-object version takes, and writes the hashes to
+ * `output` back to back (no length prefix), which needs room for 32 bytes per object. */
+WASM_EXPORT void abis__hash_tx_request_batch(uint8_t const* tx_requests_buf, uint8_t* output)
+{
+    hash_batch<TxRequest<NT>>(tx_requests_buf, output, [](TxRequest<NT> const& tx_request) {
+        return tx_request.hash();
+    });
+}
+
+WASM_EXPORT void abis__compute_function_leaf_batch(uint8_t const* function_leaf_preimages_buf, uint8_t* output)
+{
+    hash_batch<FunctionLeafPreimage<NT>>(
+        function_leaf_preimages_buf, output, [](FunctionLeafPreimage<NT> const& leaf_preimage) {
+            return leaf_preimage.hash();
+        });
+}
+
+WASM_EXPORT void abis__compute_contract_leaf_batch(uint8_t const* contract_leaf_preimages_buf, uint8_t* output)
+{
+    hash_batch<NewContractData<NT>>(contract_leaf_preimages_buf, output, [](NewContractData<NT> const& leaf_preimage) {
+        return leaf_preimage.hash();
+    });
+}
+
+WASM_EXPORT void abis__compute_transaction_hash_batch(uint8_t const* signed_tx_requests_buf, uint8_t* output)
+{
+    hash_batch<SignedTxRequest<NT>>(signed_tx_requests_buf, output, [](SignedTxRequest<NT> const& signed_tx_request) {
+        return signed_tx_request.hash();
+    });
+}
+
+WASM_EXPORT void abis__compute_call_stack_item_hash_batch(uint8_t const* call_stack_items_buf, uint8_t* output)
+{
+    hash_batch<CallStackItem<NT, PublicTypes>>(
+        call_stack_items_buf, output, [](CallStackItem<NT, PublicTypes> const& call_stack_item) {
+            return get_call_stack_item_hash(call_stack_item);
+        });
+}
+
+WASM_EXPORT void abis__compute_message_secret_hash_batch(uint8_t const* secrets_buf, uint8_t* output)
+{
+    hash_batch<NT::fr>(secrets_buf, output, compute_message_secret_hash);
+}
+
+/**
+ * @brief Converts serialized kernel circuit public inputs to the sparse encoding of `write_sparse`, in which runs of
+ * empty array items (most of the kernel's arrays, most of the time) are recorded compactly
+ *
+ * @param public_inputs_buf the public inputs as `write` serializes them
+ * @param sparse_public_inputs_buf_out set to a `malloc`ed buffer holding the sparse encoding
+ * @return the size of the sparse encoding
+ */
+WASM_EXPORT size_t abis__kernel_circuit_public_inputs_to_sparse(uint8_t const* public_inputs_buf,
+                                                                uint8_t const** sparse_public_inputs_buf_out)
+{
+    KernelCircuitPublicInputs<NT> public_inputs;
+    read(public_inputs_buf, public_inputs);
+
+    std::vector<uint8_t> sparse_vec;
+    write_sparse(sparse_vec, public_inputs);
+
+    auto* raw_buf = (uint8_t*)malloc(sparse_vec.size());
+    memcpy(raw_buf, (void*)sparse_vec.data(), sparse_vec.size());
+    *sparse_public_inputs_buf_out = raw_buf;
+    return sparse_vec.size();
+}
+
+/**
+ * @brief Converts kernel circuit public inputs in the sparse encoding back to the usual one, exactly
+ *
+ * @param sparse_public_inputs_buf the public inputs as `write_sparse` serializes them
+ * @param public_inputs_buf_out set to a `malloc`ed buffer holding the public inputs as `write` serializes them
+ * @return the size of the usual encoding
+ */
+WASM_EXPORT size_t abis__kernel_circuit_public_inputs_from_sparse(uint8_t const* sparse_public_inputs_buf,
+                                                                  uint8_t const** public_inputs_buf_out)
+{
+    KernelCircuitPublicInputs<NT> public_inputs;
+    read_sparse(sparse_public_inputs_buf, public_inputs);
+
+    std::vector<uint8_t> public_inputs_vec;
+    write(public_inputs_vec, public_inputs);
+
+    auto* raw_buf = (uint8_t*)malloc(public_inputs_vec.size());
+    memcpy(raw_buf, (void*)public_inputs_vec.data(), public_inputs_vec.size());
+    *public_inputs_buf_out = raw_buf;
+    return public_inputs_vec.size();
 }
 
 /* Typescript test helpers that call as_string_output() to stress serialization.
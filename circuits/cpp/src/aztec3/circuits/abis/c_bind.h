@@ -25,9 +25,24 @@ WASM_EXPORT void abis__hash_constructor(uint8_t const* func_data_buf,
 
 CBIND_DECL(abis__compute_contract_address);
 CBIND_DECL(abis__silo_commitment);
+CBIND_DECL(abis__get_vk_hash_cache_stats);
 
 WASM_EXPORT void abis__compute_message_secret_hash(uint8_t const* secret, uint8_t* output);
+
+WASM_EXPORT void abis__init_hash_tables();
 WASM_EXPORT void abis__compute_contract_leaf(uint8_t const* contract_leaf_preimage_buf, uint8_t* output);
 WASM_EXPORT void abis__compute_transaction_hash(uint8_t const* signed_tx_request_buf, uint8_t* output);
 WASM_EXPORT void abis__compute_call_stack_item_hash(uint8_t const* call_stack_item_buf, uint8_t* output);
 WASM_EXPORT void abis__compute_var_args_hash(uint8_t const* args_buf, uint8_t* output);
+
+WASM_EXPORT void abis__hash_tx_request_batch(uint8_t const* tx_requests_buf, uint8_t* output);
+WASM_EXPORT void abis__compute_function_leaf_batch(uint8_t const* function_leaf_preimages_buf, uint8_t* output);
+WASM_EXPORT void abis__compute_contract_leaf_batch(uint8_t const* contract_leaf_preimages_buf, uint8_t* output);
+WASM_EXPORT void abis__compute_transaction_hash_batch(uint8_t const* signed_tx_requests_buf, uint8_t* output);
+WASM_EXPORT void abis__compute_call_stack_item_hash_batch(uint8_t const* call_stack_items_buf, uint8_t* output);
+WASM_EXPORT void abis__compute_message_secret_hash_batch(uint8_t const* secrets_buf, uint8_t* output);
+
+WASM_EXPORT size_t abis__kernel_circuit_public_inputs_to_sparse(uint8_t const* public_inputs_buf,
+                                                                uint8_t const** sparse_public_inputs_buf_out);
+WASM_EXPORT size_t abis__kernel_circuit_public_inputs_from_sparse(uint8_t const* sparse_public_inputs_buf,
+                                                                  uint8_t const** public_inputs_buf_out);
@@ -1,22 +1,32 @@
 #include "c_bind.h"
 
+#include "call_stack_item.hpp"
 #include "function_leaf_preimage.hpp"
+#include "previous_kernel_data_view.hpp"
+#include "serialized_layouts.hpp"
 #include "tx_request.hpp"
+#include "types.hpp"
 
 #include "aztec3/circuits/abis/new_contract_data.hpp"
 #include "aztec3/circuits/abis/signed_tx_request.hpp"
 #include "aztec3/circuits/hash.hpp"
+#include "aztec3/circuits/vk_hash_cache.hpp"
+#include "aztec3/utils/field_serialization.hpp"
 
 #include <barretenberg/barretenberg.hpp>
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <type_traits>
 #include <vector>
 
 namespace {
 
 using NT = aztec3::utils::types::NativeTypes;
 using aztec3::circuits::abis::NewContractData;
+using aztec3::utils::FIELD_SERIALIZED_SIZE;
+using aztec3::utils::fixed_serialized_size;
 // num_leaves = 2**h = 2<<(h-1)
 // root layer does not count in height
 constexpr size_t FUNCTION_TREE_NUM_LEAVES = 2 << (aztec3::FUNCTION_TREE_HEIGHT - 1);
@@ -45,6 +55,57 @@ template <size_t NUM_BYTES> std::string bytes_to_hex_str(std::array<uint8_t, NUM
     return stream.str();
 }
 
+/**
+ * @brief The number of bytes `write` actually produces for a default T
+ */
+template <typename T> size_t written_size()
+{
+    using serialize::write;
+
+    std::vector<uint8_t> buf;
+    write(buf, T{});
+    return buf.size();
+}
+
+/**
+ * @brief Checks that `Layout` lists the types of `fields`, and that each of them is what `read` finds at the offset the
+ * layout gives it, in the struct serialized at `start` bytes into `buf`
+ */
+template <typename Layout, typename... Fields>
+void expect_fields_at_layout_offsets(std::vector<uint8_t> const& buf, size_t start, Fields const&... fields)
+{
+    static_assert(std::is_same_v<Layout, aztec3::utils::FixedSerializedLayout<Fields...>>);
+    ASSERT_EQ(buf.size(), start + Layout::size);
+    size_t index = 0;
+    auto const expect_field = [&]<typename Field>(Field const& field) {
+        EXPECT_EQ(aztec3::utils::read_at<Field>(buf.data(), start + Layout::offset(index)), field) << "field " << index;
+        index++;
+    };
+    (expect_field(fields), ...);
+}
+
+/**
+ * @brief As above, for the struct `value` alone
+ */
+template <typename Layout, typename T, typename... Fields>
+void expect_fields_at_layout_offsets(T const& value, Fields const&... fields)
+{
+    using serialize::write;
+
+    std::vector<uint8_t> buf;
+    write(buf, value);
+    expect_fields_at_layout_offsets<Layout>(buf, 0, fields...);
+}
+
+template <size_t NUM_BYTES> std::array<uint8_t, NUM_BYTES> random_bytes()
+{
+    std::array<uint8_t, NUM_BYTES> bytes;
+    for (auto& byte : bytes) {
+        byte = engine.get_random_uint8();
+    }
+    return bytes;
+}
+
 }  // namespace
 
 namespace aztec3::circuits::abis {
@@ -148,6 +209,44 @@ TEST(abi_tests, hash_vk)
     EXPECT_EQ(got_hash, expected_hash);
 }
 
+TEST(abi_tests, hash_vk_is_served_from_cache_on_repeat)
+{
+    // Initialize some random VK data
+    NT::VKData vk_data;
+    vk_data.composer_type = engine.get_random_uint32();
+    vk_data.circuit_size = static_cast<uint32_t>(1) << (engine.get_random_uint8() >> 3);
+    vk_data.num_public_inputs = engine.get_random_uint32();
+    vk_data.commitments["foo"] = g1::element::random_element();
+    std::vector<uint8_t> vk_data_vec;
+    write(vk_data_vec, vk_data);
+
+    auto& cache = aztec3::circuits::get_vk_hash_cache();
+    auto const stats_before = cache.stats();
+
+    std::array<uint8_t, sizeof(NT::fr)> first_output = { 0 };
+    std::array<uint8_t, sizeof(NT::fr)> second_output = { 0 };
+    abis__hash_vk(vk_data_vec.data(), first_output.data());
+    abis__hash_vk(vk_data_vec.data(), second_output.data());
+
+    auto const stats_after = cache.stats();
+
+    // the first call computes the hash, the second one is served from the cache and must agree with it
+    EXPECT_EQ(stats_after.misses, stats_before.misses + 1);
+    EXPECT_EQ(stats_after.hits, stats_before.hits + 1);
+    EXPECT_EQ(first_output, second_output);
+    EXPECT_EQ(NT::fr::serialize_from_buffer(second_output.data()),
+              vk_data.compress_native(aztec3::GeneratorIndex::VK));
+
+    // a different vk must not be given the cached hash
+    vk_data.num_public_inputs += 1;
+    std::vector<uint8_t> other_vk_data_vec;
+    write(other_vk_data_vec, vk_data);
+    std::array<uint8_t, sizeof(NT::fr)> other_output = { 0 };
+    abis__hash_vk(other_vk_data_vec.data(), other_output.data());
+    EXPECT_EQ(NT::fr::serialize_from_buffer(other_output.data()), vk_data.compress_native(aztec3::GeneratorIndex::VK));
+    EXPECT_NE(other_output, first_output);
+}
+
 TEST(abi_tests, compute_function_leaf)
 {
     // Construct FunctionLeafPreimage with some randomized fields
@@ -237,6 +336,29 @@ TEST(abi_tests, compute_function_tree)
     EXPECT_EQ(got_tree, plonk::stdlib::merkle_tree::compute_tree_native(leaves_frs));
 }
 
+TEST(abi_tests, sparse_tree_matches_dense_tree)
+{
+    // a taller tree than the function tree, with leaf counts on either side of a power of 2
+    constexpr size_t TREE_HEIGHT = 8;
+    NT::fr const zero_leaf = FunctionLeafPreimage<NT>().hash();
+    auto const empty_subtree_roots = aztec3::circuits::compute_empty_subtree_roots<NT, TREE_HEIGHT>(zero_leaf);
+
+    for (size_t const num_nonzero_leaves : std::array<size_t, 7>{ 0, 1, 2, 7, 8, 9, size_t(1) << TREE_HEIGHT }) {
+        std::vector<NT::fr> leaves_frs;
+        for (size_t l = 0; l < num_nonzero_leaves; l++) {
+            leaves_frs.push_back(NT::fr::random_element());
+        }
+        NT::fr const sparse_root =
+            aztec3::circuits::compute_sparse_tree_root<NT, TREE_HEIGHT>(leaves_frs, empty_subtree_roots);
+        std::vector<NT::fr> const sparse_tree =
+            aztec3::circuits::compute_sparse_tree<NT, TREE_HEIGHT>(leaves_frs, empty_subtree_roots);
+
+        leaves_frs.resize(size_t(1) << TREE_HEIGHT, zero_leaf);
+        EXPECT_EQ(sparse_root, plonk::stdlib::merkle_tree::compute_tree_root_native(leaves_frs));
+        EXPECT_EQ(sparse_tree, plonk::stdlib::merkle_tree::compute_tree_native(leaves_frs));
+    }
+}
+
 TEST(abi_tests, hash_constructor)
 {
     // Randomize required values
@@ -357,4 +479,342 @@ TEST(abi_tests, compute_transaction_hash)
     EXPECT_EQ(got_tx_hash, preimage.hash());
 }
 
+TEST(abi_tests, fixed_serialized_sizes_match_write)
+{
+    EXPECT_EQ(fixed_serialized_size<NewContractData<NT>>, written_size<NewContractData<NT>>());
+    EXPECT_EQ(fixed_serialized_size<PublicDataRead<NT>>, written_size<PublicDataRead<NT>>());
+    EXPECT_EQ(fixed_serialized_size<PublicDataUpdateRequest<NT>>, written_size<PublicDataUpdateRequest<NT>>());
+    EXPECT_EQ(fixed_serialized_size<FunctionData<NT>>, written_size<FunctionData<NT>>());
+    EXPECT_EQ(fixed_serialized_size<OptionallyRevealedData<NT>>, written_size<OptionallyRevealedData<NT>>());
+    EXPECT_EQ(fixed_serialized_size<PrivateHistoricTreeRoots<NT>>, written_size<PrivateHistoricTreeRoots<NT>>());
+    EXPECT_EQ(fixed_serialized_size<CombinedHistoricTreeRoots<NT>>, written_size<CombinedHistoricTreeRoots<NT>>());
+    EXPECT_EQ(fixed_serialized_size<ContractDeploymentData<NT>>, written_size<ContractDeploymentData<NT>>());
+    EXPECT_EQ(fixed_serialized_size<TxContext<NT>>, written_size<TxContext<NT>>());
+    EXPECT_EQ(fixed_serialized_size<CombinedConstantData<NT>>, written_size<CombinedConstantData<NT>>());
+
+    EXPECT_EQ(written_size<NT::AggregationObject>() + CombinedAccumulatedDataTailLayout::size,
+              written_size<CombinedAccumulatedData<NT>>());
+}
+
+TEST(abi_tests, serialized_layout_offsets_match_read)
+{
+    auto const random_address = []() { return NT::address(NT::fr::random_element()); };
+
+    NewContractData<NT> const new_contract_data{ .contract_address = random_address(),
+                                                 .portal_contract_address = random_address(),
+                                                 .function_tree_root = NT::fr::random_element() };
+    expect_fields_at_layout_offsets<NewContractDataLayout>(new_contract_data,
+                                                           new_contract_data.contract_address,
+                                                           new_contract_data.portal_contract_address,
+                                                           new_contract_data.function_tree_root);
+
+    PublicDataRead<NT> const public_data_read{ .leaf_index = NT::fr::random_element(),
+                                               .value = NT::fr::random_element() };
+    expect_fields_at_layout_offsets<PublicDataReadLayout>(
+        public_data_read, public_data_read.leaf_index, public_data_read.value);
+
+    PublicDataUpdateRequest<NT> const update_request{ .leaf_index = NT::fr::random_element(),
+                                                      .old_value = NT::fr::random_element(),
+                                                      .new_value = NT::fr::random_element() };
+    expect_fields_at_layout_offsets<PublicDataUpdateRequestLayout>(
+        update_request, update_request.leaf_index, update_request.old_value, update_request.new_value);
+
+    // the booleans differ, so that swapping them is caught
+    FunctionData<NT> const function_data{ .function_selector = engine.get_random_uint32(),
+                                          .is_private = true,
+                                          .is_constructor = false };
+    expect_fields_at_layout_offsets<FunctionDataLayout>(
+        function_data, function_data.function_selector, function_data.is_private, function_data.is_constructor);
+
+    PrivateHistoricTreeRoots<NT> const private_roots{ .private_data_tree_root = NT::fr::random_element(),
+                                                      .nullifier_tree_root = NT::fr::random_element(),
+                                                      .contract_tree_root = NT::fr::random_element(),
+                                                      .l1_to_l2_messages_tree_root = NT::fr::random_element(),
+                                                      .private_kernel_vk_tree_root = NT::fr::random_element() };
+    expect_fields_at_layout_offsets<PrivateHistoricTreeRootsLayout>(private_roots,
+                                                                    private_roots.private_data_tree_root,
+                                                                    private_roots.nullifier_tree_root,
+                                                                    private_roots.contract_tree_root,
+                                                                    private_roots.l1_to_l2_messages_tree_root,
+                                                                    private_roots.private_kernel_vk_tree_root);
+
+    ContractDeploymentData<NT> const deployment_data{
+        .deployer_public_key = { NT::fr::random_element(), NT::fr::random_element() },
+        .constructor_vk_hash = NT::fr::random_element(),
+        .function_tree_root = NT::fr::random_element(),
+        .contract_address_salt = NT::fr::random_element(),
+        .portal_contract_address = random_address(),
+    };
+    expect_fields_at_layout_offsets<ContractDeploymentDataLayout>(deployment_data,
+                                                                  deployment_data.deployer_public_key,
+                                                                  deployment_data.constructor_vk_hash,
+                                                                  deployment_data.function_tree_root,
+                                                                  deployment_data.contract_address_salt,
+                                                                  deployment_data.portal_contract_address);
+
+    OptionallyRevealedData<NT> const revealed_data{ .call_stack_item_hash = NT::fr::random_element(),
+                                                    .function_data = function_data,
+                                                    .vk_hash = NT::fr::random_element(),
+                                                    .portal_contract_address = random_address(),
+                                                    .pay_fee_from_l1 = true,
+                                                    .pay_fee_from_public_l2 = false,
+                                                    .called_from_l1 = true,
+                                                    .called_from_public_l2 = false };
+    expect_fields_at_layout_offsets<OptionallyRevealedDataLayout>(revealed_data,
+                                                                  revealed_data.call_stack_item_hash,
+                                                                  revealed_data.function_data,
+                                                                  revealed_data.vk_hash,
+                                                                  revealed_data.portal_contract_address,
+                                                                  revealed_data.pay_fee_from_l1,
+                                                                  revealed_data.pay_fee_from_public_l2,
+                                                                  revealed_data.called_from_l1,
+                                                                  revealed_data.called_from_public_l2);
+
+    CombinedHistoricTreeRoots<NT> const historic_roots{ .private_historic_tree_roots = private_roots };
+    expect_fields_at_layout_offsets<CombinedHistoricTreeRootsLayout>(historic_roots,
+                                                                     historic_roots.private_historic_tree_roots);
+
+    TxContext<NT> const tx_context{ .is_fee_payment_tx = true,
+                                    .is_rebate_payment_tx = false,
+                                    .is_contract_deployment_tx = true,
+                                    .contract_deployment_data = deployment_data };
+    expect_fields_at_layout_offsets<TxContextLayout>(tx_context,
+                                                     tx_context.is_fee_payment_tx,
+                                                     tx_context.is_rebate_payment_tx,
+                                                     tx_context.is_contract_deployment_tx,
+                                                     tx_context.contract_deployment_data);
+
+    CombinedConstantData<NT> const constant_data{ .historic_tree_roots = historic_roots, .tx_context = tx_context };
+    expect_fields_at_layout_offsets<CombinedConstantDataLayout>(
+        constant_data, constant_data.historic_tree_roots, constant_data.tx_context);
+
+    // the tail of the accumulated data starts after its aggregation object, with an item set in every array
+    CombinedAccumulatedData<NT> accumulated_data;
+    accumulated_data.new_commitments[0] = NT::fr::random_element();
+    accumulated_data.new_nullifiers[0] = NT::fr::random_element();
+    accumulated_data.private_call_stack[0] = NT::fr::random_element();
+    accumulated_data.public_call_stack[0] = NT::fr::random_element();
+    accumulated_data.new_l2_to_l1_msgs[0] = NT::fr::random_element();
+    accumulated_data.encrypted_logs_hash = { NT::fr::random_element(), NT::fr::random_element() };
+    accumulated_data.unencrypted_logs_hash = { NT::fr::random_element(), NT::fr::random_element() };
+    accumulated_data.encrypted_log_preimages_length = NT::fr::random_element();
+    accumulated_data.unencrypted_log_preimages_length = NT::fr::random_element();
+    accumulated_data.new_contracts[0] = new_contract_data;
+    accumulated_data.optionally_revealed_data[0] = revealed_data;
+    accumulated_data.public_data_update_requests[0] = update_request;
+    accumulated_data.public_data_reads[0] = public_data_read;
+    std::vector<uint8_t> accumulated_data_buf;
+    write(accumulated_data_buf, accumulated_data);
+    expect_fields_at_layout_offsets<CombinedAccumulatedDataTailLayout>(
+        accumulated_data_buf,
+        written_size<NT::AggregationObject>(),
+        accumulated_data.new_commitments,
+        accumulated_data.new_nullifiers,
+        accumulated_data.private_call_stack,
+        accumulated_data.public_call_stack,
+        accumulated_data.new_l2_to_l1_msgs,
+        accumulated_data.encrypted_logs_hash,
+        accumulated_data.unencrypted_logs_hash,
+        accumulated_data.encrypted_log_preimages_length,
+        accumulated_data.unencrypted_log_preimages_length,
+        accumulated_data.new_contracts,
+        accumulated_data.optionally_revealed_data,
+        accumulated_data.public_data_update_requests,
+        accumulated_data.public_data_reads);
+}
+
+TEST(abi_tests, previous_kernel_data_view_matches_read)
+{
+    KernelCircuitPublicInputs<NT> public_inputs;
+    // a non-empty aggregation object, so that the offsets after it depend on its contents
+    public_inputs.end.aggregation_object.public_inputs = { NT::fr(1), NT::fr(2), NT::fr(3) };
+    public_inputs.end.new_commitments[0] = NT::fr::random_element();
+    public_inputs.end.public_data_reads[1] = PublicDataRead<NT>{ .leaf_index = 4, .value = 5 };
+    public_inputs.constants.historic_tree_roots.private_historic_tree_roots.contract_tree_root = 6;
+    public_inputs.constants.tx_context.is_contract_deployment_tx = true;
+    public_inputs.is_private = false;
+
+    NT::Proof proof;
+    proof.proof_data = { 1, 2, 3, 4, 5 };
+
+    NT::VKData vk_data;
+    vk_data.composer_type = engine.get_random_uint32();
+    vk_data.circuit_size = 1024;
+    vk_data.num_public_inputs = engine.get_random_uint32();
+    vk_data.commitments["foo"] = g1::element::random_element();
+
+    NT::uint32 const vk_index = 3;
+    std::array<NT::fr, VK_TREE_HEIGHT> vk_path = zero_array<NT::fr, VK_TREE_HEIGHT>();
+    vk_path[1] = 7;
+
+    using serialize::write;
+
+    // the serialized form of a PreviousKernelData (whose vk is written as its verification_key_data), followed by
+    // something else
+    std::vector<uint8_t> buf;
+    write(buf, public_inputs);
+    write(buf, proof);
+    write(buf, vk_data);
+    write(buf, vk_index);
+    write(buf, vk_path);
+    size_t const kernel_data_size = buf.size();
+    write(buf, NT::fr(8));
+
+    PreviousKernelDataView const view(buf.data());
+    EXPECT_EQ(view.end(), public_inputs.end);
+    EXPECT_EQ(view.constants(), public_inputs.constants);
+    EXPECT_EQ(view.is_private(), public_inputs.is_private);
+    EXPECT_EQ(view.public_inputs(), public_inputs);
+    EXPECT_EQ(view.proof().proof_data, proof.proof_data);
+    EXPECT_EQ(view.vk_index(), vk_index);
+    EXPECT_EQ(view.vk_path(), vk_path);
+    EXPECT_EQ(view.size(), kernel_data_size);
+}
+
+TEST(abi_tests, bulk_field_serialization_matches_per_element)
+{
+    using serialize::write;
+
+    std::array<std::array<NT::fr, 3>, 5> fields;
+    for (auto& row : fields) {
+        for (auto& field : row) {
+            field = NT::fr::random_element();
+        }
+    }
+    // the extremes of the range
+    fields[0][0] = NT::fr(0);
+    fields[0][1] = NT::fr(-1);
+
+    std::vector<uint8_t> per_element;
+    write(per_element, fields);
+
+    std::vector<uint8_t> bulk;
+    write_field_array(bulk, fields);
+    EXPECT_EQ(bulk, per_element);
+
+    std::vector<uint8_t> flat_bytes;
+    for (auto const& row : fields) {
+        auto const row_bytes = aztec3::utils::field_array_to_bytes(row);
+        flat_bytes.insert(flat_bytes.end(), row_bytes.begin(), row_bytes.end());
+    }
+    EXPECT_EQ(flat_bytes, per_element);
+
+    std::array<std::array<NT::fr, 3>, 5> bulk_read;
+    uint8_t const* it = per_element.data();
+    read_field_array(it, bulk_read);
+    EXPECT_EQ(bulk_read, fields);
+    EXPECT_EQ(it, per_element.data() + per_element.size());
+}
+
+TEST(abi_tests, kernel_circuit_public_inputs_sparse_encoding_roundtrip)
+{
+    KernelCircuitPublicInputs<NT> public_inputs{};
+    public_inputs.end.new_commitments[0] = NT::fr(1);
+    public_inputs.end.new_commitments[1] = NT::fr(2);
+    public_inputs.end.new_nullifiers[3] = NT::fr(3);
+    public_inputs.end.public_data_reads[0] = { .leaf_index = 4, .value = 5 };
+    public_inputs.end.public_data_reads[2] = { .leaf_index = 6, .value = 7 };
+    public_inputs.end.private_call_stack.fill(NT::fr(8));
+
+    std::vector<uint8_t> full;
+    write(full, public_inputs);
+    std::vector<uint8_t> sparse;
+    write_sparse(sparse, public_inputs);
+    EXPECT_LT(sparse.size(), full.size());
+
+    KernelCircuitPublicInputs<NT> sparse_read;
+    uint8_t const* it = sparse.data();
+    read_sparse(it, sparse_read);
+    EXPECT_EQ(sparse_read, public_inputs);
+    EXPECT_EQ(it, sparse.data() + sparse.size());
+
+    // the c_binds convert between the two encodings exactly
+    uint8_t const* to_sparse_buf = nullptr;
+    size_t const to_sparse_size = abis__kernel_circuit_public_inputs_to_sparse(full.data(), &to_sparse_buf);
+    EXPECT_EQ(std::vector<uint8_t>(to_sparse_buf, to_sparse_buf + to_sparse_size), sparse);
+
+    uint8_t const* from_sparse_buf = nullptr;
+    size_t const from_sparse_size = abis__kernel_circuit_public_inputs_from_sparse(sparse.data(), &from_sparse_buf);
+    EXPECT_EQ(std::vector<uint8_t>(from_sparse_buf, from_sparse_buf + from_sparse_size), full);
+
+    free((void*)to_sparse_buf);
+    free((void*)from_sparse_buf);
+}
+
+TEST(abi_tests, hash_batches_match_single_hashes)
+{
+    constexpr size_t NUM_ITEMS = 5;
+
+    std::vector<TxRequest<NT>> tx_requests;
+    std::vector<FunctionLeafPreimage<NT>> function_leaf_preimages;
+    std::vector<NewContractData<NT>> contract_leaf_preimages;
+    std::vector<SignedTxRequest<NT>> signed_tx_requests;
+    std::vector<CallStackItem<NT, PublicTypes>> call_stack_items;
+    std::vector<NT::fr> secrets;
+    for (size_t i = 0; i < NUM_ITEMS; i++) {
+        tx_requests.push_back(TxRequest<NT>{
+            .from = NT::fr::random_element(),
+            .to = NT::fr::random_element(),
+            .function_data = FunctionData<NT>(),
+            .args_hash = NT::fr::random_element(),
+            .nonce = NT::fr::random_element(),
+            .tx_context = TxContext<NT>(),
+            .chain_id = NT::fr::random_element(),
+        });
+        contract_leaf_preimages.push_back(NewContractData<NT>{
+            .contract_address = NT::fr::random_element(),
+            .portal_contract_address = NT::fr::random_element(),
+            .function_tree_root = NT::fr::random_element(),
+        });
+        signed_tx_requests.push_back(SignedTxRequest<NT>{
+            .tx_request = tx_requests.back(),
+            .signature = NT::ecdsa_signature{ random_bytes<32>(), random_bytes<32>(), 27 },
+        });
+        CallStackItem<NT, PublicTypes> call_stack_item{};
+        call_stack_item.contract_address = NT::fr::random_element();
+        call_stack_item.function_data.function_selector = engine.get_random_uint32();
+        call_stack_item.public_inputs.args_hash = NT::fr::random_element();
+        call_stack_items.push_back(call_stack_item);
+        function_leaf_preimages.push_back(FunctionLeafPreimage<NT>{
+            .function_selector = engine.get_random_uint32(),
+            .is_private = static_cast<bool>(engine.get_random_uint8() & 1),
+            .vk_hash = NT::fr::random_element(),
+            .acir_hash = NT::fr::random_element(),
+        });
+        secrets.push_back(NT::fr::random_element());
+    }
+
+    // hashes every item of `items` with `batch_func` and checks each against `single_func`
+    auto check_batch = [](auto const& items, auto batch_func, auto single_func) {
+        using serialize::write;
+
+        std::vector<uint8_t> items_buf;
+        write(items_buf, items);
+        std::vector<uint8_t> output(items.size() * FIELD_SERIALIZED_SIZE);
+        batch_func(items_buf.data(), output.data());
+
+        for (size_t i = 0; i < items.size(); i++) {
+            std::vector<uint8_t> item_buf;
+            write(item_buf, items[i]);
+            std::array<uint8_t, FIELD_SERIALIZED_SIZE> single_output = { 0 };
+            single_func(item_buf.data(), single_output.data());
+            EXPECT_TRUE(
+                std::equal(single_output.begin(), single_output.end(), output.begin() + i * FIELD_SERIALIZED_SIZE));
+        }
+    };
+
+    check_batch(tx_requests, abis__hash_tx_request_batch, abis__hash_tx_request);
+    check_batch(function_leaf_preimages, abis__compute_function_leaf_batch, abis__compute_function_leaf);
+    check_batch(contract_leaf_preimages, abis__compute_contract_leaf_batch, abis__compute_contract_leaf);
+    check_batch(signed_tx_requests, abis__compute_transaction_hash_batch, abis__compute_transaction_hash);
+    check_batch(call_stack_items, abis__compute_call_stack_item_hash_batch, abis__compute_call_stack_item_hash);
+    check_batch(secrets, abis__compute_message_secret_hash_batch, abis__compute_message_secret_hash);
+
+    // an empty batch writes nothing
+    using serialize::write;
+    std::vector<uint8_t> empty_buf;
+    write(empty_buf, std::vector<NT::fr>{});
+    abis__compute_message_secret_hash_batch(empty_buf.data(), nullptr);
+}
+
 }  // namespace aztec3::circuits::abis
@@ -6,6 +6,8 @@
 
 #include "aztec3/constants.hpp"
 #include "aztec3/utils/array.hpp"
+#include "aztec3/utils/field_serialization.hpp"
+#include "aztec3/utils/sparse_array_serialization.hpp"
 #include "aztec3/utils/types/circuit_types.hpp"
 #include "aztec3/utils/types/convert.hpp"
 #include "aztec3/utils/types/native_types.hpp"
@@ -14,6 +16,10 @@
 
 namespace aztec3::circuits::abis {
 
+using aztec3::utils::read_field_array;
+using aztec3::utils::read_sparse_array;
+using aztec3::utils::write_field_array;
+using aztec3::utils::write_sparse_array;
 using aztec3::utils::zero_array;
 using aztec3::utils::types::CircuitTypes;
 using aztec3::utils::types::NativeTypes;
@@ -228,13 +234,13 @@ template <typename NCT> void read(uint8_t const*& it, CombinedAccumulatedData<NC
     using serialize::read;
 
     read(it, accum_data.aggregation_object);
-    read(it, accum_data.new_commitments);
-    read(it, accum_data.new_nullifiers);
-    read(it, accum_data.private_call_stack);
-    read(it, accum_data.public_call_stack);
-    read(it, accum_data.new_l2_to_l1_msgs);
-    read(it, accum_data.encrypted_logs_hash);
-    read(it, accum_data.unencrypted_logs_hash);
+    read_field_array(it, accum_data.new_commitments);
+    read_field_array(it, accum_data.new_nullifiers);
+    read_field_array(it, accum_data.private_call_stack);
+    read_field_array(it, accum_data.public_call_stack);
+    read_field_array(it, accum_data.new_l2_to_l1_msgs);
+    read_field_array(it, accum_data.encrypted_logs_hash);
+    read_field_array(it, accum_data.unencrypted_logs_hash);
     read(it, accum_data.encrypted_log_preimages_length);
     read(it, accum_data.unencrypted_log_preimages_length);
     read(it, accum_data.new_contracts);
@@ -248,13 +254,13 @@ template <typename NCT> void write(std::vector<uint8_t>& buf, CombinedAccumulate
     using serialize::write;
 
     write(buf, accum_data.aggregation_object);
-    write(buf, accum_data.new_commitments);
-    write(buf, accum_data.new_nullifiers);
-    write(buf, accum_data.private_call_stack);
-    write(buf, accum_data.public_call_stack);
-    write(buf, accum_data.new_l2_to_l1_msgs);
-    write(buf, accum_data.encrypted_logs_hash);
-    write(buf, accum_data.unencrypted_logs_hash);
+    write_field_array(buf, accum_data.new_commitments);
+    write_field_array(buf, accum_data.new_nullifiers);
+    write_field_array(buf, accum_data.private_call_stack);
+    write_field_array(buf, accum_data.public_call_stack);
+    write_field_array(buf, accum_data.new_l2_to_l1_msgs);
+    write_field_array(buf, accum_data.encrypted_logs_hash);
+    write_field_array(buf, accum_data.unencrypted_logs_hash);
     write(buf, accum_data.encrypted_log_preimages_length);
     write(buf, accum_data.unencrypted_log_preimages_length);
     write(buf, accum_data.new_contracts);
@@ -263,6 +269,54 @@ template <typename NCT> void write(std::vector<uint8_t>& buf, CombinedAccumulate
     write(buf, accum_data.public_data_reads);
 };
 
+/**
+ * @brief As `read`, for data written by `write_sparse`
+ */
+template <typename NCT> void read_sparse(uint8_t const*& it, CombinedAccumulatedData<NCT>& accum_data)
+{
+    using serialize::read;
+
+    read(it, accum_data.aggregation_object);
+    read_sparse_array(it, accum_data.new_commitments);
+    read_sparse_array(it, accum_data.new_nullifiers);
+    read_sparse_array(it, accum_data.private_call_stack);
+    read_sparse_array(it, accum_data.public_call_stack);
+    read_sparse_array(it, accum_data.new_l2_to_l1_msgs);
+    read_field_array(it, accum_data.encrypted_logs_hash);
+    read_field_array(it, accum_data.unencrypted_logs_hash);
+    read(it, accum_data.encrypted_log_preimages_length);
+    read(it, accum_data.unencrypted_log_preimages_length);
+    read_sparse_array(it, accum_data.new_contracts);
+    read_sparse_array(it, accum_data.optionally_revealed_data);
+    read_sparse_array(it, accum_data.public_data_update_requests);
+    read_sparse_array(it, accum_data.public_data_reads);
+};
+
+/**
+ * @brief As `write`, but with the fixed-size arrays (which are mostly empty) in the sparse encoding of
+ * `write_sparse_array`
+ * @details The logs hashes are always both set or both empty, so are written as they are.
+ */
+template <typename NCT> void write_sparse(std::vector<uint8_t>& buf, CombinedAccumulatedData<NCT> const& accum_data)
+{
+    using serialize::write;
+
+    write(buf, accum_data.aggregation_object);
+    write_sparse_array(buf, accum_data.new_commitments);
+    write_sparse_array(buf, accum_data.new_nullifiers);
+    write_sparse_array(buf, accum_data.private_call_stack);
+    write_sparse_array(buf, accum_data.public_call_stack);
+    write_sparse_array(buf, accum_data.new_l2_to_l1_msgs);
+    write_field_array(buf, accum_data.encrypted_logs_hash);
+    write_field_array(buf, accum_data.unencrypted_logs_hash);
+    write(buf, accum_data.encrypted_log_preimages_length);
+    write(buf, accum_data.unencrypted_log_preimages_length);
+    write_sparse_array(buf, accum_data.new_contracts);
+    write_sparse_array(buf, accum_data.optionally_revealed_data);
+    write_sparse_array(buf, accum_data.public_data_update_requests);
+    write_sparse_array(buf, accum_data.public_data_reads);
+};
+
 template <typename NCT> std::ostream& operator<<(std::ostream& os, CombinedAccumulatedData<NCT> const& accum_data)
 {
     return os << "aggregation_object:\n"
@@ -0,0 +1,71 @@
+#include "c_bind.h"
+#include "function_leaf_preimage.hpp"
+
+#include "aztec3/utils/types/native_types.hpp"
+
+#include <barretenberg/barretenberg.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <chrono>
+#include <vector>
+
+namespace {
+
+using aztec3::circuits::abis::FunctionLeafPreimage;
+using NT = aztec3::utils::types::NativeTypes;
+
+std::vector<uint8_t> function_leaves_buf()
+{
+    std::vector<NT::fr> leaves;
+    for (size_t i = 0; i < 4; i++) {
+        leaves.push_back(FunctionLeafPreimage<NT>{ .function_selector = static_cast<uint32_t>(i + 1) }.hash());
+    }
+    std::vector<uint8_t> buf;
+    write(buf, leaves);
+    return buf;
+}
+
+/**
+ * @brief The first `abis__compute_function_tree_root` of the process, with (`state.range(0)` = 1) or without the
+ * tables built up front by `abis__init_hash_tables`, timing the call alone
+ *
+ * @details The tables are only ever built once per process, so each variant must be run in a process of its own, e.g.
+ * `--benchmark_filter=first_function_tree_root/0` then `--benchmark_filter=first_function_tree_root/1`.
+ */
+void first_function_tree_root(benchmark::State& state)
+{
+    if (state.range(0) == 1) {
+        abis__init_hash_tables();
+    }
+    auto const buf = function_leaves_buf();
+    std::array<uint8_t, sizeof(NT::fr)> output{};
+    for (auto _ : state) {
+        auto const start = std::chrono::high_resolution_clock::now();
+        abis__compute_function_tree_root(buf.data(), output.data());
+        auto const end = std::chrono::high_resolution_clock::now();
+        state.SetIterationTime(std::chrono::duration<double>(end - start).count());
+        benchmark::DoNotOptimize(output);
+    }
+}
+BENCHMARK(first_function_tree_root)->Arg(0)->Arg(1)->Iterations(1)->UseManualTime();
+
+/**
+ * @brief `abis__compute_function_tree_root` at steady state, for comparison
+ */
+void function_tree_root(benchmark::State& state)
+{
+    abis__init_hash_tables();
+    auto const buf = function_leaves_buf();
+    std::array<uint8_t, sizeof(NT::fr)> output{};
+    for (auto _ : state) {
+        abis__compute_function_tree_root(buf.data(), output.data());
+        benchmark::DoNotOptimize(output);
+    }
+}
+BENCHMARK(function_tree_root);
+
+}  // namespace
+
+BENCHMARK_MAIN();
@@ -94,6 +94,32 @@ template <typename NCT> void write(std::vector<uint8_t>& buf, KernelCircuitPubli
     write(buf, public_inputs.is_private);
 };
 
+/**
+ * @brief As `read`, for public inputs written by `write_sparse`
+ */
+template <typename NCT> void read_sparse(uint8_t const*& it, KernelCircuitPublicInputs<NCT>& public_inputs)
+{
+    using serialize::read;
+
+    read_sparse(it, public_inputs.end);
+    read(it, public_inputs.constants);
+    read(it, public_inputs.is_private);
+};
+
+/**
+ * @brief As `write`, but with the accumulated data's mostly-empty arrays in the sparse encoding (see
+ * `write_sparse_array`), which `read_sparse` converts back exactly
+ */
+template <typename NCT>
+void write_sparse(std::vector<uint8_t>& buf, KernelCircuitPublicInputs<NCT> const& public_inputs)
+{
+    using serialize::write;
+
+    write_sparse(buf, public_inputs.end);
+    write(buf, public_inputs.constants);
+    write(buf, public_inputs.is_private);
+};
+
 template <typename NCT> std::ostream& operator<<(std::ostream& os, KernelCircuitPublicInputs<NCT> const& public_inputs)
 {
     return os << "end:\n"
@@ -1,11 +1,14 @@
 #pragma once
 
 #include "aztec3/utils/array.hpp"
+#include "aztec3/utils/field_serialization.hpp"
 #include "aztec3/utils/types/circuit_types.hpp"
 #include "aztec3/utils/types/convert.hpp"
 
 namespace aztec3::circuits::abis {
 
+using aztec3::utils::read_field_array;
+using aztec3::utils::write_field_array;
 using aztec3::utils::zero_array;
 using aztec3::utils::types::CircuitTypes;
 using aztec3::utils::types::NativeTypes;
@@ -45,7 +48,7 @@ template <typename NCT, unsigned int N> void read(uint8_t const*& it, Membership
     using serialize::read;
 
     read(it, obj.leaf_index);
-    read(it, obj.sibling_path);
+    read_field_array(it, obj.sibling_path);
 };
 
 template <typename NCT, unsigned int N> void write(std::vector<uint8_t>& buf, MembershipWitness<NCT, N> const& obj)
@@ -53,7 +56,7 @@ template <typename NCT, unsigned int N> void write(std::vector<uint8_t>& buf, Me
     using serialize::write;
 
     write(buf, obj.leaf_index);
-    write(buf, obj.sibling_path);
+    write_field_array(buf, obj.sibling_path);
 };
 
 template <typename NCT, unsigned int N> std::ostream& operator<<(std::ostream& os, MembershipWitness<NCT, N> const& obj)
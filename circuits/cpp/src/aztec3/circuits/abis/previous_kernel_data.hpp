@@ -1,5 +1,7 @@
 #pragma once
 #include "aztec3/circuits/abis/kernel_circuit_public_inputs.hpp"
+#include "aztec3/utils/crs_factory.hpp"
+#include "aztec3/utils/field_serialization.hpp"
 #include "aztec3/utils/types/circuit_types.hpp"
 #include "aztec3/utils/types/convert.hpp"
 #include "aztec3/utils/types/native_types.hpp"
@@ -8,6 +10,8 @@
 
 namespace aztec3::circuits::abis {
 
+using aztec3::utils::read_field_array;
+using aztec3::utils::write_field_array;
 using aztec3::utils::types::CircuitTypes;
 using aztec3::utils::types::NativeTypes;
 using std::is_same;
@@ -66,7 +70,7 @@ template <typename B> inline void read(B& buf, verification_key& key)
     // Note this matches write() below
     verification_key_data data;
     read(buf, data);
-    key = verification_key{ std::move(data), barretenberg::srs::get_crs_factory()->get_verifier_crs() };
+    key = verification_key{ std::move(data), aztec3::utils::get_crs_factory()->get_verifier_crs() };
 }
 
 template <typename NCT> void read(uint8_t const*& it, PreviousKernelData<NCT>& kernel_data)
@@ -78,7 +82,7 @@ template <typename NCT> void read(uint8_t const*& it, PreviousKernelData<NCT>& k
     read(it, kernel_data.proof);
     read(it, kernel_data.vk);
     read(it, kernel_data.vk_index);
-    read(it, kernel_data.vk_path);
+    read_field_array(it, kernel_data.vk_path);
 };
 
 template <typename NCT> void write(std::vector<uint8_t>& buf, PreviousKernelData<NCT> const& kernel_data)
@@ -90,7 +94,34 @@ template <typename NCT> void write(std::vector<uint8_t>& buf, PreviousKernelData
     write(buf, kernel_data.proof);
     write(buf, *kernel_data.vk);
     write(buf, kernel_data.vk_index);
-    write(buf, kernel_data.vk_path);
+    write_field_array(buf, kernel_data.vk_path);
+};
+
+/**
+ * @brief As `read`, for kernel data whose public inputs are in the sparse encoding (see `write_sparse`)
+ */
+template <typename NCT> void read_sparse(uint8_t const*& it, PreviousKernelData<NCT>& kernel_data)
+{
+    using aztec3::circuits::abis::read;
+    using serialize::read;
+
+    read_sparse(it, kernel_data.public_inputs);
+    read(it, kernel_data.proof);
+    read(it, kernel_data.vk);
+    read(it, kernel_data.vk_index);
+    read_field_array(it, kernel_data.vk_path);
+};
+
+template <typename NCT> void write_sparse(std::vector<uint8_t>& buf, PreviousKernelData<NCT> const& kernel_data)
+{
+    using aztec3::circuits::abis::write;
+    using serialize::write;
+
+    write_sparse(buf, kernel_data.public_inputs);
+    write(buf, kernel_data.proof);
+    write(buf, *kernel_data.vk);
+    write(buf, kernel_data.vk_index);
+    write_field_array(buf, kernel_data.vk_path);
 };
 
 template <typename NCT> std::ostream& operator<<(std::ostream& os, PreviousKernelData<NCT> const& kernel_data)
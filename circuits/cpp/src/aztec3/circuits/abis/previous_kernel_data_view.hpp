@@ -0,0 +1,105 @@
+#pragma once
+#include "combined_accumulated_data.hpp"
+#include "combined_constant_data.hpp"
+#include "kernel_circuit_public_inputs.hpp"
+#include "previous_kernel_data.hpp"
+#include "serialized_layouts.hpp"
+
+#include "aztec3/constants.hpp"
+#include "aztec3/utils/serialized_layout.hpp"
+#include "aztec3/utils/types/native_types.hpp"
+
+#include <barretenberg/barretenberg.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+
+namespace aztec3::circuits::abis {
+
+using aztec3::utils::read_at;
+using aztec3::utils::skip_serialized;
+
+/**
+ * @brief A read-only view of a serialized `PreviousKernelData<NT>` which decodes a field only when it is accessed
+ *
+ * @details Reading a `PreviousKernelData` decodes all of it, including the proof and the vk (which is built into a
+ * full `verification_key` against the verifier CRS), where e.g. the base rollup only needs the public inputs and the
+ * proof. The fixed-size parts are located with the layouts of `serialized_layouts.hpp`. Locating anything after a
+ * variable-size part (the aggregation object, the proof, the vk) steps over that part once, and the offset found is
+ * kept for later accesses.
+ *
+ * The view does not own the serialized data, which must outlive it.
+ */
+class PreviousKernelDataView {
+  public:
+    explicit PreviousKernelDataView(uint8_t const* data) : data(data) {}
+
+    [[nodiscard]] KernelCircuitPublicInputs<NT> public_inputs() const
+    {
+        return read_at<KernelCircuitPublicInputs<NT>>(data, 0);
+    }
+
+    [[nodiscard]] CombinedAccumulatedData<NT> end() const { return read_at<CombinedAccumulatedData<NT>>(data, 0); }
+
+    [[nodiscard]] CombinedConstantData<NT> constants() const
+    {
+        return read_at<CombinedConstantData<NT>>(data, constants_offset());
+    }
+
+    [[nodiscard]] NT::boolean is_private() const
+    {
+        return read_at<NT::boolean>(data, constants_offset() + PublicInputsTailLayout::offset(1));
+    }
+
+    [[nodiscard]] NT::Proof proof() const { return read_at<NT::Proof>(data, proof_offset()); }
+
+    [[nodiscard]] NT::uint32 vk_index() const { return read_at<NT::uint32>(data, vk_index_offset()); }
+
+    [[nodiscard]] std::array<NT::fr, VK_TREE_HEIGHT> vk_path() const
+    {
+        return read_at<std::array<NT::fr, VK_TREE_HEIGHT>>(data, vk_index_offset() + VkMembershipLayout::offset(1));
+    }
+
+    /**
+     * @brief The length of the whole serialized `PreviousKernelData`, i.e. where whatever follows it starts
+     */
+    [[nodiscard]] size_t size() const { return vk_index_offset() + VkMembershipLayout::size; }
+
+  private:
+    // the public inputs after `end`: constants, is_private
+    using PublicInputsTailLayout = aztec3::utils::FixedSerializedLayout<CombinedConstantData<NT>, NT::boolean>;
+    // the fields after the vk: vk_index, vk_path
+    using VkMembershipLayout = aztec3::utils::FixedSerializedLayout<NT::uint32, std::array<NT::fr, VK_TREE_HEIGHT>>;
+
+    size_t constants_offset() const
+    {
+        if (!cached_constants_offset) {
+            uint8_t const* it = data;
+            skip_serialized<NT::AggregationObject>(it);
+            cached_constants_offset = static_cast<size_t>(it - data) + CombinedAccumulatedDataTailLayout::size;
+        }
+        return *cached_constants_offset;
+    }
+
+    size_t proof_offset() const { return constants_offset() + PublicInputsTailLayout::size; }
+
+    size_t vk_index_offset() const
+    {
+        if (!cached_vk_index_offset) {
+            uint8_t const* it = data + proof_offset();
+            skip_serialized<NT::Proof>(it);
+            // the vk is written as its verification_key_data, which reads without building the key itself
+            skip_serialized<NT::VKData>(it);
+            cached_vk_index_offset = static_cast<size_t>(it - data);
+        }
+        return *cached_vk_index_offset;
+    }
+
+    uint8_t const* data;
+    mutable std::optional<size_t> cached_constants_offset;
+    mutable std::optional<size_t> cached_vk_index_offset;
+};
+
+}  // namespace aztec3::circuits::abis
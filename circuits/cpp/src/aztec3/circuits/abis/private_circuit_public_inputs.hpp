@@ -5,6 +5,7 @@
 
 #include "aztec3/constants.hpp"
 #include "aztec3/utils/array.hpp"
+#include "aztec3/utils/field_serialization.hpp"
 #include "aztec3/utils/types/circuit_types.hpp"
 #include "aztec3/utils/types/convert.hpp"
 #include "aztec3/utils/types/native_types.hpp"
@@ -13,6 +14,8 @@
 
 namespace aztec3::circuits::abis {
 
+using aztec3::utils::read_field_array;
+using aztec3::utils::write_field_array;
 using aztec3::utils::zero_array;
 using aztec3::utils::types::CircuitTypes;
 using aztec3::utils::types::NativeTypes;
@@ -200,15 +203,15 @@ template <typename NCT> void read(uint8_t const*& it, PrivateCircuitPublicInputs
     PrivateCircuitPublicInputs<NCT>& pis = private_circuit_public_inputs;
     read(it, pis.call_context);
     read(it, pis.args_hash);
-    read(it, pis.return_values);
-    read(it, pis.read_requests);
-    read(it, pis.new_commitments);
-    read(it, pis.new_nullifiers);
-    read(it, pis.private_call_stack);
-    read(it, pis.public_call_stack);
-    read(it, pis.new_l2_to_l1_msgs);
-    read(it, pis.encrypted_logs_hash);
-    read(it, pis.unencrypted_logs_hash);
+    read_field_array(it, pis.return_values);
+    read_field_array(it, pis.read_requests);
+    read_field_array(it, pis.new_commitments);
+    read_field_array(it, pis.new_nullifiers);
+    read_field_array(it, pis.private_call_stack);
+    read_field_array(it, pis.public_call_stack);
+    read_field_array(it, pis.new_l2_to_l1_msgs);
+    read_field_array(it, pis.encrypted_logs_hash);
+    read_field_array(it, pis.unencrypted_logs_hash);
     read(it, pis.encrypted_log_preimages_length);
     read(it, pis.unencrypted_log_preimages_length);
     read(it, pis.historic_private_data_tree_root);
@@ -227,15 +230,15 @@ void write(std::vector<uint8_t>& buf, PrivateCircuitPublicInputs<NCT> const& pri
 
     write(buf, pis.call_context);
     write(buf, pis.args_hash);
-    write(buf, pis.return_values);
-    write(buf, pis.read_requests);
-    write(buf, pis.new_commitments);
-    write(buf, pis.new_nullifiers);
-    write(buf, pis.private_call_stack);
-    write(buf, pis.public_call_stack);
-    write(buf, pis.new_l2_to_l1_msgs);
-    write(buf, pis.encrypted_logs_hash);
-    write(buf, pis.unencrypted_logs_hash);
+    write_field_array(buf, pis.return_values);
+    write_field_array(buf, pis.read_requests);
+    write_field_array(buf, pis.new_commitments);
+    write_field_array(buf, pis.new_nullifiers);
+    write_field_array(buf, pis.private_call_stack);
+    write_field_array(buf, pis.public_call_stack);
+    write_field_array(buf, pis.new_l2_to_l1_msgs);
+    write_field_array(buf, pis.encrypted_logs_hash);
+    write_field_array(buf, pis.unencrypted_logs_hash);
     write(buf, pis.encrypted_log_preimages_length);
     write(buf, pis.unencrypted_log_preimages_length);
     write(buf, pis.historic_private_data_tree_root);
@@ -6,6 +6,7 @@
 #include "../../constants.hpp"
 
 #include "aztec3/utils/array.hpp"
+#include "aztec3/utils/field_serialization.hpp"
 #include "aztec3/utils/msgpack_derived_equals.hpp"
 #include "aztec3/utils/msgpack_derived_output.hpp"
 #include "aztec3/utils/types/circuit_types.hpp"
@@ -15,6 +16,8 @@
 
 namespace aztec3::circuits::abis {
 
+using aztec3::utils::read_field_array;
+using aztec3::utils::write_field_array;
 using aztec3::utils::zero_array;
 using aztec3::utils::types::CircuitTypes;
 using aztec3::utils::types::NativeTypes;
@@ -132,15 +135,15 @@ template <typename NCT> void read(uint8_t const*& it, PublicCircuitPublicInputs<
     PublicCircuitPublicInputs<NCT>& pis = public_circuit_public_inputs;
     read(it, pis.call_context);
     read(it, pis.args_hash);
-    read(it, pis.return_values);
+    read_field_array(it, pis.return_values);
 
     read(it, pis.contract_storage_update_requests);
     read(it, pis.contract_storage_reads);
 
-    read(it, pis.public_call_stack);
-    read(it, pis.new_commitments);
-    read(it, pis.new_nullifiers);
-    read(it, pis.new_l2_to_l1_msgs);
+    read_field_array(it, pis.public_call_stack);
+    read_field_array(it, pis.new_commitments);
+    read_field_array(it, pis.new_nullifiers);
+    read_field_array(it, pis.new_l2_to_l1_msgs);
 
     read(it, pis.historic_public_data_tree_root);
 
@@ -156,15 +159,15 @@ void write(std::vector<uint8_t>& buf, PublicCircuitPublicInputs<NCT> const& publ
 
     write(buf, pis.call_context);
     write(buf, pis.args_hash);
-    write(buf, pis.return_values);
+    write_field_array(buf, pis.return_values);
 
     write(buf, pis.contract_storage_update_requests);
     write(buf, pis.contract_storage_reads);
 
-    write(buf, pis.public_call_stack);
-    write(buf, pis.new_commitments);
-    write(buf, pis.new_nullifiers);
-    write(buf, pis.new_l2_to_l1_msgs);
+    write_field_array(buf, pis.public_call_stack);
+    write_field_array(buf, pis.new_commitments);
+    write_field_array(buf, pis.new_nullifiers);
+    write_field_array(buf, pis.new_l2_to_l1_msgs);
 
     write(buf, pis.historic_public_data_tree_root);
 
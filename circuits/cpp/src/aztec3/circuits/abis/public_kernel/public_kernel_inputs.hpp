@@ -57,6 +57,26 @@ template <typename NCT> void write(std::vector<uint8_t>& buf, PublicKernelInputs
     write(buf, public_kernel_inputs.public_call);
 };
 
+/**
+ * @brief As `read`, with the previous kernel's public inputs in the sparse encoding (see `write_sparse`)
+ */
+template <typename NCT> void read_sparse(uint8_t const*& it, PublicKernelInputs<NCT>& public_kernel_inputs)
+{
+    using serialize::read;
+
+    read_sparse(it, public_kernel_inputs.previous_kernel);
+    read(it, public_kernel_inputs.public_call);
+};
+
+template <typename NCT>
+void write_sparse(std::vector<uint8_t>& buf, PublicKernelInputs<NCT> const& public_kernel_inputs)
+{
+    using serialize::write;
+
+    write_sparse(buf, public_kernel_inputs.previous_kernel);
+    write(buf, public_kernel_inputs.public_call);
+};
+
 template <typename NCT> std::ostream& operator<<(std::ostream& os, PublicKernelInputs<NCT> const& public_kernel_inputs)
 {
     return os << "previous_kernel:\n"
@@ -2,15 +2,20 @@
 #include "../../append_only_tree_snapshot.hpp"
 #include "../../membership_witness.hpp"
 #include "../../previous_kernel_data.hpp"
+#include "../../previous_kernel_data_view.hpp"
 #include "../constant_rollup_data.hpp"
 #include "../nullifier_leaf_preimage.hpp"
 
 #include "aztec3/constants.hpp"
+#include "aztec3/utils/field_serialization.hpp"
 
 #include <barretenberg/barretenberg.hpp>
 
 namespace aztec3::circuits::abis {
 
+using aztec3::utils::read_field_array;
+using aztec3::utils::write_field_array;
+
 template <typename NCT> struct BaseRollupInputs {
     using fr = typename NCT::fr;
 
@@ -64,50 +69,113 @@ template <typename NCT> struct BaseRollupInputs {
     bool operator==(BaseRollupInputs<NCT> const&) const = default;
 };
 
-template <typename NCT> void read(uint8_t const*& it, BaseRollupInputs<NCT>& obj)
+/**
+ * @brief Reads everything after the kernel data, see `read`
+ */
+template <typename NCT> void read_after_kernel_data(uint8_t const*& it, BaseRollupInputs<NCT>& obj)
 {
     using serialize::read;
 
-    read(it, obj.kernel_data);
     read(it, obj.start_private_data_tree_snapshot);
     read(it, obj.start_nullifier_tree_snapshot);
     read(it, obj.start_contract_tree_snapshot);
     read(it, obj.start_public_data_tree_root);
     read(it, obj.low_nullifier_leaf_preimages);
     read(it, obj.low_nullifier_membership_witness);
-    read(it, obj.new_commitments_subtree_sibling_path);
-    read(it, obj.new_nullifiers_subtree_sibling_path);
-    read(it, obj.new_contracts_subtree_sibling_path);
-    read(it, obj.new_public_data_update_requests_sibling_paths);
-    read(it, obj.new_public_data_reads_sibling_paths);
+    read_field_array(it, obj.new_commitments_subtree_sibling_path);
+    read_field_array(it, obj.new_nullifiers_subtree_sibling_path);
+    read_field_array(it, obj.new_contracts_subtree_sibling_path);
+    read_field_array(it, obj.new_public_data_update_requests_sibling_paths);
+    read_field_array(it, obj.new_public_data_reads_sibling_paths);
     read(it, obj.historic_private_data_tree_root_membership_witnesses);
     read(it, obj.historic_contract_tree_root_membership_witnesses);
     read(it, obj.historic_l1_to_l2_msg_tree_root_membership_witnesses);
     read(it, obj.constants);
 };
 
-template <typename NCT> void write(std::vector<uint8_t>& buf, BaseRollupInputs<NCT> const& obj)
+template <typename NCT> void read(uint8_t const*& it, BaseRollupInputs<NCT>& obj)
+{
+    using serialize::read;
+
+    read(it, obj.kernel_data);
+    read_after_kernel_data(it, obj);
+};
+
+/**
+ * @brief As `read`, but decoding only what the base rollup circuit uses of the kernel data: each kernel's public
+ * inputs and proof
+ * @details The kernels' vks are stepped over rather than built into `verification_key`s, so `vk` is set to null (and
+ * `vk_index`, `vk_path` to their defaults) in both. Every field is set, and the public inputs are decoded straight into
+ * `obj`, so `obj` may be a reused one (see `get_input_slot`).
+ */
+inline void read_kernel_public_inputs_and_proofs(uint8_t const*& it, BaseRollupInputs<NT>& obj)
+{
+    using serialize::read;
+
+    for (auto& kernel_data : obj.kernel_data) {
+        PreviousKernelDataView const view(it);
+        uint8_t const* public_inputs_it = it;
+        read(public_inputs_it, kernel_data.public_inputs);
+        kernel_data.proof = view.proof();
+        kernel_data.vk = nullptr;
+        kernel_data.vk_index = 0;
+        kernel_data.vk_path = zero_array<NT::fr, VK_TREE_HEIGHT>();
+        it += view.size();
+    }
+    read_after_kernel_data(it, obj);
+};
+
+/**
+ * @brief As `read`, with each kernel's public inputs in the sparse encoding (see `write_sparse`)
+ */
+template <typename NCT> void read_sparse(uint8_t const*& it, BaseRollupInputs<NCT>& obj)
+{
+    for (auto& kernel_data : obj.kernel_data) {
+        read_sparse(it, kernel_data);
+    }
+    read_after_kernel_data(it, obj);
+};
+
+/**
+ * @brief Writes everything after the kernel data, see `write`
+ */
+template <typename NCT> void write_after_kernel_data(std::vector<uint8_t>& buf, BaseRollupInputs<NCT> const& obj)
 {
     using serialize::write;
 
-    write(buf, obj.kernel_data);
     write(buf, obj.start_private_data_tree_snapshot);
     write(buf, obj.start_nullifier_tree_snapshot);
     write(buf, obj.start_contract_tree_snapshot);
     write(buf, obj.start_public_data_tree_root);
     write(buf, obj.low_nullifier_leaf_preimages);
     write(buf, obj.low_nullifier_membership_witness);
-    write(buf, obj.new_commitments_subtree_sibling_path);
-    write(buf, obj.new_nullifiers_subtree_sibling_path);
-    write(buf, obj.new_contracts_subtree_sibling_path);
-    write(buf, obj.new_public_data_update_requests_sibling_paths);
-    write(buf, obj.new_public_data_reads_sibling_paths);
+    write_field_array(buf, obj.new_commitments_subtree_sibling_path);
+    write_field_array(buf, obj.new_nullifiers_subtree_sibling_path);
+    write_field_array(buf, obj.new_contracts_subtree_sibling_path);
+    write_field_array(buf, obj.new_public_data_update_requests_sibling_paths);
+    write_field_array(buf, obj.new_public_data_reads_sibling_paths);
     write(buf, obj.historic_private_data_tree_root_membership_witnesses);
     write(buf, obj.historic_contract_tree_root_membership_witnesses);
     write(buf, obj.historic_l1_to_l2_msg_tree_root_membership_witnesses);
     write(buf, obj.constants);
 };
 
+template <typename NCT> void write(std::vector<uint8_t>& buf, BaseRollupInputs<NCT> const& obj)
+{
+    using serialize::write;
+
+    write(buf, obj.kernel_data);
+    write_after_kernel_data(buf, obj);
+};
+
+template <typename NCT> void write_sparse(std::vector<uint8_t>& buf, BaseRollupInputs<NCT> const& obj)
+{
+    for (auto const& kernel_data : obj.kernel_data) {
+        write_sparse(buf, kernel_data);
+    }
+    write_after_kernel_data(buf, obj);
+};
+
 template <typename NCT> std::ostream& operator<<(std::ostream& os, BaseRollupInputs<NCT> const& obj)
 {
     return os << "kernel_data:\n"
@@ -4,11 +4,15 @@
 #include "aztec3/circuits/abis/append_only_tree_snapshot.hpp"
 #include "aztec3/circuits/abis/rollup/merge/previous_rollup_data.hpp"
 #include "aztec3/constants.hpp"
+#include "aztec3/utils/field_serialization.hpp"
 
 #include <ostream>
 
 namespace aztec3::circuits::abis {
 
+using aztec3::utils::read_field_array;
+using aztec3::utils::write_field_array;
+
 // TODO: The copy constructor for this struct may throw memory access out of bounds
 // Hit when running aztec3-packages/yarn-project/circuits.js/src/rollup/rollup_wasm_wrapper.test.ts."calls
 // root_rollup__sim"
@@ -37,11 +41,11 @@ template <typename NCT> void read(uint8_t const*& it, RootRollupInputs<NCT>& obj
     using serialize::read;
 
     read(it, obj.previous_rollup_data);
-    read(it, obj.new_historic_private_data_tree_root_sibling_path);
-    read(it, obj.new_historic_contract_tree_root_sibling_path);
-    read(it, obj.l1_to_l2_messages);
-    read(it, obj.new_l1_to_l2_message_tree_root_sibling_path);
-    read(it, obj.new_historic_l1_to_l2_message_roots_tree_sibling_path);
+    read_field_array(it, obj.new_historic_private_data_tree_root_sibling_path);
+    read_field_array(it, obj.new_historic_contract_tree_root_sibling_path);
+    read_field_array(it, obj.l1_to_l2_messages);
+    read_field_array(it, obj.new_l1_to_l2_message_tree_root_sibling_path);
+    read_field_array(it, obj.new_historic_l1_to_l2_message_roots_tree_sibling_path);
     read(it, obj.start_l1_to_l2_message_tree_snapshot);
     read(it, obj.start_historic_tree_l1_to_l2_message_tree_roots_snapshot);
 };
@@ -51,11 +55,11 @@ template <typename NCT> void write(std::vector<uint8_t>& buf, RootRollupInputs<N
     using serialize::write;
 
     write(buf, obj.previous_rollup_data);
-    write(buf, obj.new_historic_private_data_tree_root_sibling_path);
-    write(buf, obj.new_historic_contract_tree_root_sibling_path);
-    write(buf, obj.l1_to_l2_messages);
-    write(buf, obj.new_l1_to_l2_message_tree_root_sibling_path);
-    write(buf, obj.new_historic_l1_to_l2_message_roots_tree_sibling_path);
+    write_field_array(buf, obj.new_historic_private_data_tree_root_sibling_path);
+    write_field_array(buf, obj.new_historic_contract_tree_root_sibling_path);
+    write_field_array(buf, obj.l1_to_l2_messages);
+    write_field_array(buf, obj.new_l1_to_l2_message_tree_root_sibling_path);
+    write_field_array(buf, obj.new_historic_l1_to_l2_message_roots_tree_sibling_path);
     write(buf, obj.start_l1_to_l2_message_tree_snapshot);
     write(buf, obj.start_historic_tree_l1_to_l2_message_tree_roots_snapshot);
 };
@@ -0,0 +1,135 @@
+#pragma once
+#include "combined_accumulated_data.hpp"
+#include "combined_constant_data.hpp"
+#include "combined_historic_tree_roots.hpp"
+#include "contract_deployment_data.hpp"
+#include "function_data.hpp"
+#include "new_contract_data.hpp"
+#include "optionally_revealed_data.hpp"
+#include "private_historic_tree_roots.hpp"
+#include "public_data_read.hpp"
+#include "public_data_update_request.hpp"
+#include "tx_context.hpp"
+
+#include "aztec3/utils/serialized_layout.hpp"
+#include "aztec3/utils/types/native_types.hpp"
+
+/**
+ * The serialized layouts of the fixed-layout ABI structs: each lists the struct's field types in the order its
+ * `read`/`write` handle them. `abis/c_bind.test.cpp` checks every size below against what `write` actually produces,
+ * and every field's offset against where `read` finds that field.
+ */
+namespace aztec3::circuits::abis {
+
+using NT = aztec3::utils::types::NativeTypes;
+using aztec3::utils::FixedSerializedLayout;
+
+using NewContractDataLayout = FixedSerializedLayout<NT::address, NT::fr, NT::fr>;
+
+using PublicDataReadLayout = FixedSerializedLayout<NT::fr, NT::fr>;
+
+using PublicDataUpdateRequestLayout = FixedSerializedLayout<NT::fr, NT::fr, NT::fr>;
+
+using FunctionDataLayout = FixedSerializedLayout<NT::uint32, NT::boolean, NT::boolean>;
+
+using PrivateHistoricTreeRootsLayout = FixedSerializedLayout<NT::fr, NT::fr, NT::fr, NT::fr, NT::fr>;
+
+using ContractDeploymentDataLayout =
+    FixedSerializedLayout<std::array<NT::fr, 2>, NT::fr, NT::fr, NT::fr, NT::address>;
+
+}  // namespace aztec3::circuits::abis
+
+namespace aztec3::utils {
+
+template <>
+struct FixedSerializedSize<circuits::abis::NewContractData<NT>>
+    : std::integral_constant<size_t, circuits::abis::NewContractDataLayout::size> {};
+
+template <>
+struct FixedSerializedSize<circuits::abis::PublicDataRead<NT>>
+    : std::integral_constant<size_t, circuits::abis::PublicDataReadLayout::size> {};
+
+template <>
+struct FixedSerializedSize<circuits::abis::PublicDataUpdateRequest<NT>>
+    : std::integral_constant<size_t, circuits::abis::PublicDataUpdateRequestLayout::size> {};
+
+template <>
+struct FixedSerializedSize<circuits::abis::FunctionData<NT>>
+    : std::integral_constant<size_t, circuits::abis::FunctionDataLayout::size> {};
+
+template <>
+struct FixedSerializedSize<circuits::abis::PrivateHistoricTreeRoots<NT>>
+    : std::integral_constant<size_t, circuits::abis::PrivateHistoricTreeRootsLayout::size> {};
+
+template <>
+struct FixedSerializedSize<circuits::abis::ContractDeploymentData<NT>>
+    : std::integral_constant<size_t, circuits::abis::ContractDeploymentDataLayout::size> {};
+
+}  // namespace aztec3::utils
+
+namespace aztec3::circuits::abis {
+
+// these contain the structs above, so are declared once those are known to be fixed-size
+
+using OptionallyRevealedDataLayout = FixedSerializedLayout<NT::fr,
+                                                           FunctionData<NT>,
+                                                           NT::fr,
+                                                           NT::address,
+                                                           NT::boolean,
+                                                           NT::boolean,
+                                                           NT::boolean,
+                                                           NT::boolean>;
+
+using CombinedHistoricTreeRootsLayout = FixedSerializedLayout<PrivateHistoricTreeRoots<NT>>;
+
+using TxContextLayout = FixedSerializedLayout<NT::boolean, NT::boolean, NT::boolean, ContractDeploymentData<NT>>;
+
+}  // namespace aztec3::circuits::abis
+
+namespace aztec3::utils {
+
+template <>
+struct FixedSerializedSize<circuits::abis::OptionallyRevealedData<NT>>
+    : std::integral_constant<size_t, circuits::abis::OptionallyRevealedDataLayout::size> {};
+
+template <>
+struct FixedSerializedSize<circuits::abis::CombinedHistoricTreeRoots<NT>>
+    : std::integral_constant<size_t, circuits::abis::CombinedHistoricTreeRootsLayout::size> {};
+
+template <>
+struct FixedSerializedSize<circuits::abis::TxContext<NT>>
+    : std::integral_constant<size_t, circuits::abis::TxContextLayout::size> {};
+
+}  // namespace aztec3::utils
+
+namespace aztec3::circuits::abis {
+
+using CombinedConstantDataLayout = FixedSerializedLayout<CombinedHistoricTreeRoots<NT>, TxContext<NT>>;
+
+/**
+ * @brief Everything in `CombinedAccumulatedData` after its (variable-size) aggregation object
+ */
+using CombinedAccumulatedDataTailLayout =
+    FixedSerializedLayout<decltype(CombinedAccumulatedData<NT>::new_commitments),
+                          decltype(CombinedAccumulatedData<NT>::new_nullifiers),
+                          decltype(CombinedAccumulatedData<NT>::private_call_stack),
+                          decltype(CombinedAccumulatedData<NT>::public_call_stack),
+                          decltype(CombinedAccumulatedData<NT>::new_l2_to_l1_msgs),
+                          decltype(CombinedAccumulatedData<NT>::encrypted_logs_hash),
+                          decltype(CombinedAccumulatedData<NT>::unencrypted_logs_hash),
+                          decltype(CombinedAccumulatedData<NT>::encrypted_log_preimages_length),
+                          decltype(CombinedAccumulatedData<NT>::unencrypted_log_preimages_length),
+                          decltype(CombinedAccumulatedData<NT>::new_contracts),
+                          decltype(CombinedAccumulatedData<NT>::optionally_revealed_data),
+                          decltype(CombinedAccumulatedData<NT>::public_data_update_requests),
+                          decltype(CombinedAccumulatedData<NT>::public_data_reads)>;
+
+}  // namespace aztec3::circuits::abis
+
+namespace aztec3::utils {
+
+template <>
+struct FixedSerializedSize<circuits::abis::CombinedConstantData<NT>>
+    : std::integral_constant<size_t, circuits::abis::CombinedConstantDataLayout::size> {};
+
+}  // namespace aztec3::utils
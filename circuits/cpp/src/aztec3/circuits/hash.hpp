@@ -5,10 +5,13 @@
 #include "aztec3/circuits/abis/new_contract_data.hpp"
 #include "aztec3/constants.hpp"
 #include "aztec3/utils/circuit_errors.hpp"
+#include "aztec3/utils/field_serialization.hpp"
 
 #include <barretenberg/barretenberg.hpp>
 
 #include <array>
+#include <string>
+#include <type_traits>
 #include <vector>
 
 namespace aztec3::circuits {
@@ -183,6 +186,22 @@ std::array<fr, N> get_sibling_path(MerkleTree& tree, size_t leaf_index, size_t c
     return sibling_path;
 }
 
+template <typename NCT, typename Composer, size_t SIZE, typename MessageProducer>
+    requires std::is_invocable_r_v<std::string, MessageProducer const&>
+void check_membership(Composer& composer,
+                      typename NCT::fr const& value,
+                      typename NCT::fr const& index,
+                      std::array<typename NCT::fr, SIZE> const& sibling_path,
+                      typename NCT::fr const& root,
+                      MessageProducer const& make_msg)
+{
+    const auto calculated_root = root_from_sibling_path<NCT>(value, index, sibling_path);
+    composer.do_assert(
+        calculated_root == root,
+        [&]() { return std::string("Membership check failed: ") + std::string(make_msg()); },
+        aztec3::utils::CircuitErrorCode::MEMBERSHIP_CHECK_FAILED);
+}
+
 template <typename NCT, typename Composer, size_t SIZE>
 void check_membership(Composer& composer,
                       typename NCT::fr const& value,
@@ -191,10 +210,7 @@ void check_membership(Composer& composer,
                       typename NCT::fr const& root,
                       std::string const& msg)
 {
-    const auto calculated_root = root_from_sibling_path<NCT>(value, index, sibling_path);
-    composer.do_assert(calculated_root == root,
-                       std::string("Membership check failed: ") + msg,
-                       aztec3::utils::CircuitErrorCode::MEMBERSHIP_CHECK_FAILED);
+    check_membership<NCT, Composer, SIZE>(composer, value, index, sibling_path, root, [&]() { return msg; });
 }
 
 /**
@@ -279,6 +295,102 @@ std::array<typename NCT::fr, TREE_HEIGHT> compute_empty_sibling_path(typename NC
     return sibling_path;
 }
 
+/**
+ * @brief Compute the root of an empty subtree of every height from 0 (the zero leaf) up to TREE_HEIGHT.
+ *
+ * @tparam NCT (native or circuit)
+ * @tparam TREE_HEIGHT
+ * @param zero_leaf the leaf value that corresponds to a zero preimage
+ * @return std::array<typename NCT::fr, TREE_HEIGHT + 1> where entry `h` is the root of an empty subtree of height `h`
+ */
+template <typename NCT, size_t TREE_HEIGHT>
+std::array<typename NCT::fr, TREE_HEIGHT + 1> compute_empty_subtree_roots(typename NCT::fr const& zero_leaf)
+{
+    std::array<typename NCT::fr, TREE_HEIGHT + 1> empty_subtree_roots = { zero_leaf };
+    for (size_t i = 1; i <= TREE_HEIGHT; i++) {
+        empty_subtree_roots[i] = NCT::merkle_hash(empty_subtree_roots[i - 1], empty_subtree_roots[i - 1]);
+    }
+    return empty_subtree_roots;
+}
+
+/**
+ * @brief Compute the root of a tree whose nonempty leaves are all at its left, e.g. a function tree.
+ *
+ * @details Gives the same root as `compute_tree_root_native` on the leaves right-filled with zero leaves, but only
+ * hashes the nodes above at least one of the given leaves: a node with no nonempty leaf below it is the root of an
+ * empty subtree, taken from `empty_subtree_roots`. This costs about `leaves.size() + TREE_HEIGHT` hashes rather than
+ * `2^TREE_HEIGHT`.
+ *
+ * @tparam NCT (native or circuit)
+ * @tparam TREE_HEIGHT
+ * @param leaves the nonempty leaves of the tree starting at the left, at most `2^TREE_HEIGHT` of them
+ * @param empty_subtree_roots as computed by `compute_empty_subtree_roots` for the tree's zero leaf
+ * @return NCT::fr
+ */
+template <typename NCT, size_t TREE_HEIGHT>
+typename NCT::fr compute_sparse_tree_root(std::vector<typename NCT::fr> leaves,
+                                          std::array<typename NCT::fr, TREE_HEIGHT + 1> const& empty_subtree_roots)
+{
+    ASSERT(leaves.size() <= (size_t(1) << TREE_HEIGHT));
+    if (leaves.empty()) {
+        return empty_subtree_roots[TREE_HEIGHT];
+    }
+
+    // hash each layer into the front of `leaves`, pairing a trailing odd node with an empty subtree
+    auto& layer = leaves;
+    for (size_t height = 0; height < TREE_HEIGHT; height++) {
+        size_t const num_parents = (layer.size() + 1) / 2;
+        for (size_t i = 0; i < num_parents; i++) {
+            auto const right = 2 * i + 1 < layer.size() ? layer[2 * i + 1] : empty_subtree_roots[height];
+            layer[i] = NCT::merkle_hash(layer[2 * i], right);
+        }
+        layer.resize(num_parents);
+    }
+    return layer[0];
+}
+
+/**
+ * @brief Compute all the nodes of a tree whose nonempty leaves are all at its left, e.g. a function tree.
+ *
+ * @details Gives the same nodes, in the same order, as `compute_tree_native` on the leaves right-filled with zero
+ * leaves: the leaves first, then each layer above them, and the root last. As in `compute_sparse_tree_root`, only the
+ * nodes above at least one of the given leaves are hashed, and the rest are filled in from `empty_subtree_roots`.
+ *
+ * @tparam NCT (native or circuit)
+ * @tparam TREE_HEIGHT
+ * @param leaves the nonempty leaves of the tree starting at the left, at most `2^TREE_HEIGHT` of them
+ * @param empty_subtree_roots as computed by `compute_empty_subtree_roots` for the tree's zero leaf
+ * @return std::vector<typename NCT::fr> all `2^(TREE_HEIGHT + 1) - 1` nodes of the tree
+ */
+template <typename NCT, size_t TREE_HEIGHT>
+std::vector<typename NCT::fr> compute_sparse_tree(
+    std::vector<typename NCT::fr> const& leaves,
+    std::array<typename NCT::fr, TREE_HEIGHT + 1> const& empty_subtree_roots)
+{
+    ASSERT(leaves.size() <= (size_t(1) << TREE_HEIGHT));
+
+    std::vector<typename NCT::fr> tree;
+    tree.reserve((size_t(2) << TREE_HEIGHT) - 1);
+    tree.insert(tree.end(), leaves.begin(), leaves.end());
+    tree.insert(tree.end(), (size_t(1) << TREE_HEIGHT) - leaves.size(), empty_subtree_roots[0]);
+
+    size_t layer_start = 0;
+    size_t layer_size = size_t(1) << TREE_HEIGHT;
+    size_t num_nonempty = leaves.size();
+    for (size_t height = 0; height < TREE_HEIGHT; height++) {
+        size_t const num_nonempty_parents = (num_nonempty + 1) / 2;
+        for (size_t i = 0; i < num_nonempty_parents; i++) {
+            tree.push_back(NCT::merkle_hash(tree[layer_start + 2 * i], tree[layer_start + 2 * i + 1]));
+        }
+        tree.insert(tree.end(), layer_size / 2 - num_nonempty_parents, empty_subtree_roots[height + 1]);
+
+        layer_start += layer_size;
+        layer_size /= 2;
+        num_nonempty = num_nonempty_parents;
+    }
+    return tree;
+}
+
 /**
  * @brief Compute the value to be inserted into the public data tree
  * @param value The value to be inserted into the public data tree
@@ -311,22 +423,11 @@ template <typename NCT> typename NCT::fr compute_l2_to_l1_hash(typename NCT::add
 {
     using fr = typename NCT::fr;
 
-    std::vector<fr> const inputs = {
+    std::array<fr, 5> const inputs = {
         contract_address.to_field(), rollup_version_id, portal_contract_address, chain_id, content,
     };
 
-    constexpr auto const num_bytes = 5 * 32;
-    std::array<uint8_t, num_bytes> calldata_hash_inputs_bytes;
-    // Convert all into a buffer, then copy into the array, then hash
-    for (size_t i = 0; i < inputs.size(); i++) {
-        auto as_bytes = inputs[i].to_buffer();
-
-        auto offset = i * 32;
-        std::copy(as_bytes.begin(), as_bytes.end(), calldata_hash_inputs_bytes.begin() + offset);
-    }
-
-    std::vector<uint8_t> const calldata_hash_inputs_bytes_vec(calldata_hash_inputs_bytes.begin(),
-                                                              calldata_hash_inputs_bytes.end());
+    std::vector<uint8_t> const calldata_hash_inputs_bytes_vec = aztec3::utils::field_array_to_bytes(inputs);
 
     // @todo @LHerskind NOTE sha to field!
     return sha256::sha256_to_field(calldata_hash_inputs_bytes_vec);
@@ -1,23 +1,36 @@
+#include "accumulated_data_lengths.hpp"
 #include "c_bind.h"
 #include "index.hpp"
 #include "init.hpp"
 #include "testing_harness.hpp"
+#include "utils.hpp"
 
 #include "aztec3/circuits/apps/test_apps/basic_contract_deployment/basic_contract_deployment.hpp"
 #include "aztec3/circuits/apps/test_apps/escrow/deposit.hpp"
+#include "aztec3/circuits/proving_key_cache.hpp"
 
 #include <barretenberg/barretenberg.hpp>
 
 #include <gtest/gtest.h>
 
+#include <filesystem>
+#include <string>
+#include <thread>
+
+#include <unistd.h>
+
 namespace {
 
 using aztec3::circuits::apps::test_apps::basic_contract_deployment::constructor;
 using aztec3::circuits::apps::test_apps::escrow::deposit;
+using aztec3::circuits::get_proving_key_cache;
+using aztec3::circuits::ProvingKeyCache;
 
 using aztec3::circuits::kernel::private_kernel::testing_harness::do_private_call_get_kernel_inputs_init;
 using aztec3::circuits::kernel::private_kernel::testing_harness::do_private_call_get_kernel_inputs_inner;
 using aztec3::circuits::kernel::private_kernel::testing_harness::validate_deployed_contract_address;
+using aztec3::utils::zero_array;
+using aztec3::utils::types::to_nt;
 
 }  // namespace
 
@@ -139,7 +152,7 @@ TEST_F(private_kernel_tests, circuit_create_proof_cbinds)
 
     // TODO(david): might be able to get rid of verification key buffer
     // uint8_t const* vk_buf;
-    // size_t vk_size = private_kernel__init_verification_key(pk_buf, &vk_buf);
+    // size_t vk_size = private_kernel__init_verification_key(pk_buf, true, &vk_buf);
     // info("Verification key size: ", vk_size);
 
     std::vector<uint8_t> signed_constructor_tx_request_vec;
@@ -181,4 +194,327 @@ TEST_F(private_kernel_tests, circuit_create_proof_cbinds)
     free((void*)public_inputs_buf);
 }
 
+/**
+ * @brief A proof from `private_kernel__prove` verifies through `private_kernel__verify_proof` against the key of
+ * `private_kernel__init_verification_key`, and a tampered one does not
+ */
+TEST_F(private_kernel_tests, proof_verifies_against_init_verification_key)
+{
+    NT::fr const& arg0 = 5;
+    NT::fr const& arg1 = 1;
+    NT::fr const& arg2 = 999;
+    std::array<NT::fr, 2> const& encrypted_logs_hash = { NT::fr(16), NT::fr(69) };
+    NT::fr const& encrypted_log_preimages_length = NT::fr(100);
+    auto const& private_inputs = do_private_call_get_kernel_inputs_init(
+        true, constructor, { arg0, arg1, arg2 }, encrypted_logs_hash, encrypted_log_preimages_length, true);
+
+    std::vector<uint8_t> signed_constructor_tx_request_vec;
+    write(signed_constructor_tx_request_vec, private_inputs.signed_tx_request);
+    std::vector<uint8_t> private_constructor_call_vec;
+    write(private_constructor_call_vec, private_inputs.private_call);
+
+    uint8_t const* proof_data_buf = nullptr;
+    size_t const proof_data_size = private_kernel__prove(signed_constructor_tx_request_vec.data(),
+                                                         nullptr,
+                                                         private_constructor_call_vec.data(),
+                                                         nullptr,
+                                                         true,
+                                                         &proof_data_buf);
+    std::vector<uint8_t> proof_data(proof_data_buf, proof_data_buf + proof_data_size);
+    free((void*)proof_data_buf);
+
+    uint8_t const* vk_buf = nullptr;
+    size_t const vk_size = private_kernel__init_verification_key(nullptr, true, &vk_buf);
+    ASSERT_GT(vk_size, 0U);
+    EXPECT_EQ(private_kernel__verify_proof(vk_buf, proof_data.data(), static_cast<uint32_t>(proof_data.size())), 1U);
+
+    proof_data[100] ^= 1;
+    EXPECT_EQ(private_kernel__verify_proof(vk_buf, proof_data.data(), static_cast<uint32_t>(proof_data.size())), 0U);
+    free((void*)vk_buf);
+}
+
+/**
+ * @brief The first proof of the initial kernel computes its proving key, which is then reused, and survives being
+ * serialized and being saved to and loaded from disk
+ */
+TEST_F(private_kernel_tests, proving_key_is_cached_and_round_trips)
+{
+    NT::fr const& arg0 = 5;
+    NT::fr const& arg1 = 1;
+    NT::fr const& arg2 = 999;
+    std::array<NT::fr, 2> const& encrypted_logs_hash = { NT::fr(16), NT::fr(69) };
+    NT::fr const& encrypted_log_preimages_length = NT::fr(100);
+    auto const& private_inputs = do_private_call_get_kernel_inputs_init(
+        true, constructor, { arg0, arg1, arg2 }, encrypted_logs_hash, encrypted_log_preimages_length, true);
+
+    std::vector<uint8_t> signed_constructor_tx_request_vec;
+    write(signed_constructor_tx_request_vec, private_inputs.signed_tx_request);
+    std::vector<uint8_t> private_constructor_call_vec;
+    write(private_constructor_call_vec, private_inputs.private_call);
+
+    // loading no keys leaves the key to be computed by the proof (unless an earlier proof already did)
+    ProvingKeyCache const empty_cache;
+    auto const empty_pk_vec = empty_cache.to_buffer();
+    EXPECT_EQ(private_kernel__set_proving_keys(empty_pk_vec.data()), 0U);
+
+    uint8_t const* first_proof_buf = nullptr;
+    size_t const first_proof_size = private_kernel__prove(signed_constructor_tx_request_vec.data(),
+                                                          nullptr,
+                                                          private_constructor_call_vec.data(),
+                                                          nullptr,
+                                                          true,
+                                                          &first_proof_buf);
+
+    // the serialized keys read back to the same keys
+    uint8_t const* pk_buf = nullptr;
+    size_t const pk_size = private_kernel__init_proving_key(&pk_buf);
+    ASSERT_GT(pk_size, empty_pk_vec.size());
+    ProvingKeyCache read_cache;
+    EXPECT_GE(read_cache.from_buffer(pk_buf), 1U);
+    EXPECT_EQ(read_cache.to_buffer(), std::vector<uint8_t>(pk_buf, pk_buf + pk_size));
+
+    // as do the keys saved to disk
+    auto const pk_dir =
+        (std::filesystem::temp_directory_path() / ("private_kernel_proving_keys_" + std::to_string(getpid()))).string();
+    size_t const num_saved = private_kernel__save_proving_keys(pk_dir.c_str());
+    ProvingKeyCache loaded_cache;
+    EXPECT_EQ(loaded_cache.load(pk_dir), num_saved);
+    EXPECT_EQ(loaded_cache.to_buffer(), read_cache.to_buffer());
+    std::filesystem::remove_all(pk_dir);
+
+    // proving again after loading the serialized keys proves with the key read back from them, whatever `pk_buf` the
+    // proof is passed
+    EXPECT_GE(private_kernel__set_proving_keys(pk_buf), 1U);
+    std::vector<uint8_t> const garbage_pk_vec(64, 0xff);
+    uint8_t const* second_proof_buf = nullptr;
+    size_t const second_proof_size = private_kernel__prove(signed_constructor_tx_request_vec.data(),
+                                                           nullptr,
+                                                           private_constructor_call_vec.data(),
+                                                           garbage_pk_vec.data(),
+                                                           true,
+                                                           &second_proof_buf);
+    EXPECT_EQ(second_proof_size, first_proof_size);
+
+    free((void*)pk_buf);
+    free((void*)first_proof_buf);
+    free((void*)second_proof_buf);
+}
+
+/**
+ * @brief A proof made with the cached proving key, from the witness alone, is as good as one made from a full rebuild
+ * of the circuit: the rebuilt circuit's verifier accepts both
+ * @details Proofs are blinded with fresh randomness, so two proofs of the same witness differ byte-wise however they
+ * were made.
+ */
+TEST_F(private_kernel_tests, proof_with_cached_proving_key_verifies_against_full_rebuild)
+{
+    NT::fr const& arg0 = 5;
+    NT::fr const& arg1 = 1;
+    NT::fr const& arg2 = 999;
+    std::array<NT::fr, 2> const& encrypted_logs_hash = { NT::fr(16), NT::fr(69) };
+    NT::fr const& encrypted_log_preimages_length = NT::fr(100);
+    auto const& private_inputs = do_private_call_get_kernel_inputs_init(
+        true, constructor, { arg0, arg1, arg2 }, encrypted_logs_hash, encrypted_log_preimages_length, true);
+
+    std::vector<uint8_t> signed_constructor_tx_request_vec;
+    write(signed_constructor_tx_request_vec, private_inputs.signed_tx_request);
+    std::vector<uint8_t> private_constructor_call_vec;
+    write(private_constructor_call_vec, private_inputs.private_call);
+
+    // the first proof caches the key (unless an earlier one did), so the second is made from the witness alone
+    auto const stats_before = get_proving_key_cache().stats();
+    std::array<NT::Proof, 2> cbind_proofs;
+    for (auto& cbind_proof : cbind_proofs) {
+        uint8_t const* proof_data_buf = nullptr;
+        size_t const proof_data_size = private_kernel__prove(signed_constructor_tx_request_vec.data(),
+                                                             nullptr,
+                                                             private_constructor_call_vec.data(),
+                                                             nullptr,
+                                                             true,
+                                                             &proof_data_buf);
+        cbind_proof.proof_data = std::vector<uint8_t>(proof_data_buf, proof_data_buf + proof_data_size);
+        free((void*)proof_data_buf);
+    }
+    auto const stats_after = get_proving_key_cache().stats();
+    EXPECT_EQ(stats_after.hits + stats_after.misses, stats_before.hits + stats_before.misses + 2);
+    EXPECT_LE(stats_after.misses, stats_before.misses + 1);
+    EXPECT_GE(stats_after.hits, stats_before.hits + 1);
+
+    // a full rebuild of the same circuit (up to the values of the dummy previous kernel, which are not structural)
+    PrivateKernelInputsInner<NT> const rebuild_inputs = PrivateKernelInputsInner<NT>{
+        .previous_kernel = utils::dummy_previous_kernel(true),
+        .private_call = private_inputs.private_call,
+    };
+    Composer rebuild_composer = Composer(barretenberg::srs::get_crs_factory());
+    private_kernel_circuit(rebuild_composer, rebuild_inputs, true);
+    auto rebuild_prover = rebuild_composer.create_prover();
+    auto const rebuild_proof = rebuild_prover.construct_proof();
+    auto rebuild_verifier = rebuild_composer.create_verifier();
+
+    EXPECT_TRUE(rebuild_verifier.verify_proof(rebuild_proof));
+    for (auto const& cbind_proof : cbind_proofs) {
+        EXPECT_EQ(cbind_proof.proof_data.size(), rebuild_proof.proof_data.size());
+        EXPECT_TRUE(rebuild_verifier.verify_proof(cbind_proof));
+    }
+}
+
+#ifndef NO_MULTITHREADING
+/**
+ * @brief Proofs made at the same time with the same cached proving key (each of which writes its witness into the key)
+ * are all valid
+ */
+TEST_F(private_kernel_tests, concurrent_proofs_with_cached_proving_key_verify)
+{
+    auto const& private_inputs = do_private_call_get_kernel_inputs_init(
+        true, constructor, { NT::fr(5), NT::fr(1), NT::fr(999) }, { NT::fr(16), NT::fr(69) }, NT::fr(100), true);
+
+    std::vector<uint8_t> signed_constructor_tx_request_vec;
+    write(signed_constructor_tx_request_vec, private_inputs.signed_tx_request);
+    std::vector<uint8_t> private_constructor_call_vec;
+    write(private_constructor_call_vec, private_inputs.private_call);
+
+    auto const prove = [&]() {
+        uint8_t const* proof_data_buf = nullptr;
+        size_t const proof_data_size = private_kernel__prove(signed_constructor_tx_request_vec.data(),
+                                                             nullptr,
+                                                             private_constructor_call_vec.data(),
+                                                             nullptr,
+                                                             true,
+                                                             &proof_data_buf);
+        NT::Proof proof{ .proof_data = std::vector<uint8_t>(proof_data_buf, proof_data_buf + proof_data_size) };
+        free((void*)proof_data_buf);
+        return proof;
+    };
+
+    // caches the key (unless an earlier proof did), and builds anything built lazily, on this thread
+    prove();
+
+    std::array<NT::Proof, 3> concurrent_proofs;
+    std::vector<std::thread> provers;
+    for (auto& proof : concurrent_proofs) {
+        provers.emplace_back([&]() { proof = prove(); });
+    }
+    for (auto& prover : provers) {
+        prover.join();
+    }
+
+    PrivateKernelInputsInner<NT> const rebuild_inputs = PrivateKernelInputsInner<NT>{
+        .previous_kernel = utils::dummy_previous_kernel(true),
+        .private_call = private_inputs.private_call,
+    };
+    Composer rebuild_composer = Composer(barretenberg::srs::get_crs_factory());
+    private_kernel_circuit(rebuild_composer, rebuild_inputs, true);
+    auto rebuild_verifier = rebuild_composer.create_verifier();
+    for (auto const& proof : concurrent_proofs) {
+        EXPECT_TRUE(rebuild_verifier.verify_proof(proof));
+    }
+}
+#endif
+
+/**
+ * @brief The gates of `private_kernel_circuit`, and of its array pops and pushes with bberg's helpers (which rescan
+ * every array for its length) and with the `*_with_length` helpers given the lengths, as they would be were the lengths
+ * part of `CombinedAccumulatedData`
+ */
+TEST_F(private_kernel_tests, length_tracked_array_helpers_gate_counts)
+{
+    auto const& private_inputs = do_private_call_get_kernel_inputs_inner(
+        true, constructor, { NT::fr(5), NT::fr(1), NT::fr(999) }, { NT::fr(16), NT::fr(69) }, NT::fr(100), true);
+
+    Composer kernel_composer("../barretenberg/cpp/srs_db/ignition");
+    private_kernel_circuit(kernel_composer, private_inputs, true);
+    EXPECT_FALSE(kernel_composer.failed());
+
+    // the arrays the kernel pops from and pushes to (`end` starts as a copy of the previous kernel's `end`)
+    auto const& start = private_inputs.previous_kernel.public_inputs.end;
+    auto const& private_call_public_inputs = private_inputs.private_call.call_stack_item.public_inputs;
+    NT::fr const contract_address_nullifier = NT::fr::random_element();
+
+    Composer scanning_composer("../barretenberg/cpp/srs_db/ignition");
+    auto scanning_commitments = to_ct(scanning_composer, start.new_commitments);
+    auto scanning_nullifiers = to_ct(scanning_composer, start.new_nullifiers);
+    auto scanning_call_stack = to_ct(scanning_composer, start.private_call_stack);
+    auto const scanning_public_call_stack = to_ct(scanning_composer, start.public_call_stack);
+    auto const scanning_l2_to_l1_msgs = to_ct(scanning_composer, start.new_l2_to_l1_msgs);
+    auto const scanning_gates_before = scanning_composer.num_gates;
+    plonk::stdlib::array_length<Composer>(scanning_call_stack);
+    plonk::stdlib::array_length<Composer>(scanning_public_call_stack);
+    plonk::stdlib::array_length<Composer>(scanning_l2_to_l1_msgs);
+    CT::fr const scanning_popped = plonk::stdlib::array_pop<Composer>(scanning_call_stack);
+    plonk::stdlib::array_push<Composer>(scanning_nullifiers, to_ct(scanning_composer, contract_address_nullifier));
+    plonk::stdlib::push_array_to_array<Composer>(to_ct(scanning_composer, private_call_public_inputs.new_commitments),
+                                                 scanning_commitments);
+    plonk::stdlib::push_array_to_array<Composer>(to_ct(scanning_composer, private_call_public_inputs.new_nullifiers),
+                                                 scanning_nullifiers);
+    plonk::stdlib::push_array_to_array<Composer>(
+        to_ct(scanning_composer, private_call_public_inputs.private_call_stack), scanning_call_stack);
+    auto const scanning_gates = scanning_composer.num_gates - scanning_gates_before;
+
+    Composer tracking_composer("../barretenberg/cpp/srs_db/ignition");
+    auto const given_length = [&](auto const& arr) {
+        return CT::fr::from_witness(&tracking_composer, NT::fr(aztec3::utils::array_length(arr)));
+    };
+    auto tracking_commitments = to_ct(tracking_composer, start.new_commitments);
+    auto tracking_nullifiers = to_ct(tracking_composer, start.new_nullifiers);
+    auto tracking_call_stack = to_ct(tracking_composer, start.private_call_stack);
+    CT::fr commitments_length = given_length(start.new_commitments);
+    CT::fr nullifiers_length = given_length(start.new_nullifiers);
+    CT::fr call_stack_length = given_length(start.private_call_stack);
+    auto const tracking_gates_before = tracking_composer.num_gates;
+    CT::fr const tracking_popped = array_pop_with_length<Composer>(tracking_call_stack, call_stack_length);
+    array_push_with_length<Composer>(
+        tracking_nullifiers, nullifiers_length, to_ct(tracking_composer, contract_address_nullifier));
+    push_array_to_array_with_length<Composer>(
+        to_ct(tracking_composer, private_call_public_inputs.new_commitments), tracking_commitments, commitments_length);
+    push_array_to_array_with_length<Composer>(
+        to_ct(tracking_composer, private_call_public_inputs.new_nullifiers), tracking_nullifiers, nullifiers_length);
+    push_array_to_array_with_length<Composer>(to_ct(tracking_composer, private_call_public_inputs.private_call_stack),
+                                              tracking_call_stack,
+                                              call_stack_length);
+    auto const tracking_gates = tracking_composer.num_gates - tracking_gates_before;
+
+    info("private_kernel_circuit gates: ", kernel_composer.num_gates);
+    info("its pops and pushes with bberg's helpers: ", scanning_gates);
+    info("its pops and pushes with the helpers given the lengths: ", tracking_gates);
+    info("private_kernel_circuit gates were it given the lengths (estimate): ",
+         kernel_composer.num_gates - scanning_gates + tracking_gates);
+
+    // both leave the arrays the same
+    EXPECT_EQ(tracking_popped.get_value(), scanning_popped.get_value());
+    EXPECT_EQ(to_nt<Composer>(tracking_commitments), to_nt<Composer>(scanning_commitments));
+    EXPECT_EQ(to_nt<Composer>(tracking_nullifiers), to_nt<Composer>(scanning_nullifiers));
+    EXPECT_EQ(to_nt<Composer>(tracking_call_stack), to_nt<Composer>(scanning_call_stack));
+    EXPECT_EQ(nullifiers_length.get_value(), NT::fr(aztec3::utils::array_length(to_nt<Composer>(tracking_nullifiers))));
+
+    EXPECT_FALSE(scanning_composer.failed());
+    EXPECT_FALSE(tracking_composer.failed());
+    EXPECT_LT(tracking_gates, scanning_gates);
+}
+
+/**
+ * @brief As `push_array_to_array`, `push_array_to_array_with_length` pushes a source's items after a gap in it too
+ */
+TEST_F(private_kernel_tests, push_array_to_array_with_length_skips_source_gaps)
+{
+    auto target = zero_array<NT::fr, 4>();
+    target[0] = NT::fr::random_element();
+    std::array<NT::fr, 3> const source = { NT::fr::random_element(), NT::fr(0), NT::fr::random_element() };
+
+    Composer scanning_composer("../barretenberg/cpp/srs_db/ignition");
+    auto scanning_target = to_ct(scanning_composer, target);
+    plonk::stdlib::push_array_to_array<Composer>(to_ct(scanning_composer, source), scanning_target);
+
+    Composer tracking_composer("../barretenberg/cpp/srs_db/ignition");
+    auto tracking_target = to_ct(tracking_composer, target);
+    CT::fr target_length = CT::fr::from_witness(&tracking_composer, NT::fr(1));
+    push_array_to_array_with_length<Composer>(to_ct(tracking_composer, source), tracking_target, target_length);
+
+    std::array<NT::fr, 4> const expected = { target[0], source[0], source[2], NT::fr(0) };
+    EXPECT_EQ(to_nt<Composer>(scanning_target), expected);
+    EXPECT_EQ(to_nt<Composer>(tracking_target), expected);
+    EXPECT_EQ(target_length.get_value(), NT::fr(3));
+    EXPECT_FALSE(scanning_composer.failed());
+    EXPECT_FALSE(tracking_composer.failed());
+}
+
 }  // namespace aztec3::circuits::kernel::private_kernel
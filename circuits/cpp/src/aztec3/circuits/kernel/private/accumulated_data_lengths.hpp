@@ -0,0 +1,152 @@
+#pragma once
+
+#include "init.hpp"
+
+#include <barretenberg/barretenberg.hpp>
+
+#include <array>
+#include <cstddef>
+#include <string>
+
+/**
+ * Variants of bberg's `array_push`, `array_pop` and `push_array_to_array` for arrays whose length (number of leading
+ * non-zero items) the caller already knows, and keeps up to date, where bberg's helpers rescan the array for it (in
+ * gates proportional to its size) on every call.
+ *
+ * The private kernel does not use them yet: its lengths would have to be part of `CombinedAccumulatedData` (and so of
+ * the kernel's public inputs, their serialization and the TS bindings) for a kernel to be given them rather than scan
+ * for them. `.test.cpp` reports the gates they would save it.
+ */
+namespace aztec3::circuits::kernel::private_kernel {
+
+/**
+ * @brief Constrains `length <= SIZE`, i.e. that nothing pushed so far has been dropped for lack of room
+ */
+template <typename Composer, size_t SIZE>
+void assert_length_within_capacity(plonk::stdlib::field_t<Composer> const& length, std::string const& msg)
+{
+    constexpr size_t num_bits = numeric::get_msb(SIZE) + 1;
+    (plonk::stdlib::field_t<Composer>(SIZE) - length).create_range_constraint(num_bits, msg);
+}
+
+/**
+ * @brief Asserts (natively, as `push_array_to_array` does) that `arr` has no items after its first `length`
+ */
+template <typename Composer, size_t SIZE>
+void assert_no_items_after_length([[maybe_unused]] std::array<plonk::stdlib::field_t<Composer>, SIZE> const& arr,
+                                  plonk::stdlib::field_t<Composer> const& length)
+{
+    auto const num_items = static_cast<size_t>(uint256_t(length.get_value()));
+    for (size_t i = num_items; i < SIZE; ++i) {
+        ASSERT(arr[i].get_value().is_zero());
+    }
+}
+
+/**
+ * @brief One selector per slot, true exactly at `arr[index]` (all false when `index >= SIZE`)
+ */
+template <typename Composer, size_t SIZE>
+std::array<plonk::stdlib::bool_t<Composer>, SIZE> index_selectors(plonk::stdlib::field_t<Composer> const& index)
+{
+    std::array<plonk::stdlib::bool_t<Composer>, SIZE> selectors;
+    for (size_t i = 0; i < SIZE; ++i) {
+        selectors[i] = index == plonk::stdlib::field_t<Composer>(i);
+    }
+    return selectors;
+}
+
+/**
+ * @brief `array_push` for an array whose length is already known
+ * @details As with `array_push`, a zero value leaves the array as it is, but there must still be room for it.
+ * @param arr the array to push to
+ * @param length the number of items in `arr`, updated
+ * @param value the value to push
+ */
+template <typename Composer, size_t SIZE>
+void array_push_with_length(std::array<plonk::stdlib::field_t<Composer>, SIZE>& arr,
+                            plonk::stdlib::field_t<Composer>& length,
+                            plonk::stdlib::field_t<Composer> const& value)
+{
+    using field_ct = plonk::stdlib::field_t<Composer>;
+
+    assert_no_items_after_length<Composer, SIZE>(arr, length);
+
+    auto const selectors = index_selectors<Composer, SIZE>(length);
+    for (size_t i = 0; i < SIZE; ++i) {
+        arr[i] = field_ct::conditional_assign(selectors[i], value, arr[i]);
+    }
+    // the only way for no selector to be set is a full array
+    assert_length_within_capacity<Composer, SIZE - 1>(length, "array_push cannot push to a full array");
+
+    length += field_ct(!value.is_zero());
+}
+
+/**
+ * @brief `array_pop` for an array whose length is already known
+ * @details As with `array_pop`, the array itself is left as it is.
+ * @param arr the array to pop from
+ * @param length the number of items in `arr` (not updated, as `arr` is not)
+ * @return the last item of `arr`
+ */
+template <typename Composer, size_t SIZE>
+plonk::stdlib::field_t<Composer> array_pop_with_length(std::array<plonk::stdlib::field_t<Composer>, SIZE> const& arr,
+                                                       plonk::stdlib::field_t<Composer> const& length)
+{
+    using field_ct = plonk::stdlib::field_t<Composer>;
+
+    // so that the last of its first `length` items is its last item, which `array_pop` pops
+    assert_no_items_after_length<Composer, SIZE>(arr, length);
+    length.assert_is_not_zero("array_pop cannot pop from an empty array");
+
+    auto const selectors = index_selectors<Composer, SIZE>(length - 1);
+    field_ct popped_value = 0;
+    for (size_t i = 0; i < SIZE; ++i) {
+        popped_value += field_ct(selectors[i]) * arr[i];
+    }
+    return popped_value;
+}
+
+/**
+ * @brief `push_array_to_array` for a target whose length is already known
+ *
+ * @details As with `push_array_to_array`, every non-zero value of the source is pushed, in order, including any after
+ * a zero (which is skipped), and the target must have no items after its length. The selectors of the next free slot
+ * are computed once and shifted one slot on by every item pushed, where `push_array_to_array` compares every (item,
+ * slot) pair against a running index.
+ *
+ * @param source the array whose items are pushed
+ * @param target the array to push them to
+ * @param target_length the number of items in `target`, updated
+ */
+template <typename Composer, size_t SOURCE_SIZE, size_t TARGET_SIZE>
+void push_array_to_array_with_length(std::array<plonk::stdlib::field_t<Composer>, SOURCE_SIZE> const& source,
+                                     std::array<plonk::stdlib::field_t<Composer>, TARGET_SIZE>& target,
+                                     plonk::stdlib::field_t<Composer>& target_length)
+{
+    using field_ct = plonk::stdlib::field_t<Composer>;
+    using bool_ct = plonk::stdlib::bool_t<Composer>;
+
+    assert_no_items_after_length<Composer, TARGET_SIZE>(target, target_length);
+
+    auto selectors = index_selectors<Composer, TARGET_SIZE>(target_length);
+    for (size_t i = 0; i < SOURCE_SIZE; ++i) {
+        bool_ct const is_item = !source[i].is_zero();
+        for (size_t j = 0; j < TARGET_SIZE; ++j) {
+            target[j] = field_ct::conditional_assign(is_item && selectors[j], source[i], target[j]);
+        }
+        target_length += field_ct(is_item);
+
+        if (i + 1 < SOURCE_SIZE) {
+            // the next free slot is one on if this was an item (and none once the target is full)
+            for (size_t j = TARGET_SIZE - 1; j > 0; --j) {
+                selectors[j] = (is_item && selectors[j - 1]) || (!is_item && selectors[j]);
+            }
+            selectors[0] = !is_item && selectors[0];
+        }
+    }
+
+    assert_length_within_capacity<Composer, TARGET_SIZE>(target_length,
+                                                         "push_array_to_array cannot overflow the target");
+}
+
+}  // namespace aztec3::circuits::kernel::private_kernel
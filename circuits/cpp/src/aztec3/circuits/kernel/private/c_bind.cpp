@@ -1,10 +1,20 @@
 #include "c_bind.h"
 
+#include "contract_membership_cache.hpp"
 #include "index.hpp"
 #include "utils.hpp"
 
 #include "aztec3/circuits/abis/combined_constant_data.hpp"
 #include "aztec3/circuits/abis/kernel_circuit_public_inputs.hpp"
+#include "aztec3/circuits/kernel_proof_verifier.hpp"
+#include "aztec3/circuits/mock/mock_kernel_proof.hpp"
+#include "aztec3/circuits/proving_key_cache.hpp"
+#include "aztec3/utils/batch_simulation.hpp"
+#include "aztec3/utils/input_slot.hpp"
+#include "aztec3/utils/lru_cache.hpp"
+#include "aztec3/utils/malloc_output.hpp"
+#include "aztec3/utils/mmap_crs_factory.hpp"
+#include "aztec3/utils/scratch_arena.hpp"
 
 #include <barretenberg/barretenberg.hpp>
 
@@ -12,25 +22,182 @@ namespace {
 using Composer = plonk::UltraPlonkComposer;
 using NT = aztec3::utils::types::NativeTypes;
 using DummyComposer = aztec3::utils::DummyComposer;
-using aztec3::circuits::abis::KernelCircuitPublicInputs;
 using aztec3::circuits::abis::PreviousKernelData;
 using aztec3::circuits::abis::SignedTxRequest;
 using aztec3::circuits::abis::private_kernel::PrivateCallData;
 using aztec3::circuits::abis::private_kernel::PrivateKernelInputsInit;
 using aztec3::circuits::abis::private_kernel::PrivateKernelInputsInner;
+using aztec3::circuits::circuit_structure_hash;
+using aztec3::circuits::CircuitShape;
+using aztec3::circuits::get_proving_key_cache;
+using aztec3::circuits::ProvingKeyCircuit;
+using aztec3::circuits::verify_kernel_proof;
+using aztec3::circuits::kernel::private_kernel::get_contract_membership_cache_stats;
 using aztec3::circuits::kernel::private_kernel::native_private_kernel_circuit_initial;
 using aztec3::circuits::kernel::private_kernel::native_private_kernel_circuit_inner;
 using aztec3::circuits::kernel::private_kernel::private_kernel_circuit;
+using aztec3::circuits::kernel::private_kernel::set_contract_membership_cache_enabled;
 using aztec3::circuits::kernel::private_kernel::utils::dummy_previous_kernel;
+using aztec3::circuits::mock::build_mock_kernel_circuit;
+using aztec3::circuits::mock::mock_kernel_proof;
+using aztec3::circuits::mock::mock_kernel_vk_data;
+using aztec3::circuits::mock::verify_mock_kernel_proof;
+using aztec3::utils::CacheLock;
+using aztec3::utils::get_input_slot;
+using aztec3::utils::get_scratch_arena;
+using aztec3::utils::OutputEncoding;
+using aztec3::utils::release_input_slots;
+using aztec3::utils::serialize_to_malloc_buffer;
+using aztec3::utils::serialize_to_scratch_arena;
+using aztec3::utils::simulate_batch;
+using aztec3::utils::write_to_malloc_buffer;
+
+/**
+ * @brief Decodes the inputs of the initial private kernel into the calling thread's input slot (see `get_input_slot`)
+ */
+PrivateKernelInputsInit<NT> const& read_private_kernel_inputs_init(uint8_t const* signed_tx_request_buf,
+                                                                   uint8_t const* private_call_buf)
+{
+    auto& private_inputs = get_input_slot<PrivateKernelInputsInit<NT>>();
+    read(private_call_buf, private_inputs.private_call);
+    read(signed_tx_request_buf, private_inputs.signed_tx_request);
+    return private_inputs;
+}
+
+/**
+ * @brief Decodes the inputs of an inner private kernel into the calling thread's input slot (see `get_input_slot`)
+ */
+PrivateKernelInputsInner<NT> const& read_private_kernel_inputs_inner(uint8_t const* previous_kernel_buf,
+                                                                     uint8_t const* private_call_buf)
+{
+    auto& private_inputs = get_input_slot<PrivateKernelInputsInner<NT>>();
+    read(private_call_buf, private_inputs.private_call);
+    read(previous_kernel_buf, private_inputs.previous_kernel);
+    return private_inputs;
+}
+
+/**
+ * @brief As `read_private_kernel_inputs_inner`, with the previous kernel's public inputs in the sparse encoding
+ */
+PrivateKernelInputsInner<NT> const& read_private_kernel_inputs_inner_sparse(uint8_t const* previous_kernel_buf,
+                                                                            uint8_t const* private_call_buf)
+{
+    auto& private_inputs = get_input_slot<PrivateKernelInputsInner<NT>>();
+    read(private_call_buf, private_inputs.private_call);
+    read_sparse(previous_kernel_buf, private_inputs.previous_kernel);
+    return private_inputs;
+}
+
+/**
+ * @brief The shape of the private kernel circuit built from `private_inputs`: that of the two proofs it verifies
+ */
+CircuitShape private_kernel_shape(PrivateKernelInputsInner<NT> const& private_inputs)
+{
+    auto const& private_call_vk = *private_inputs.private_call.vk;
+    auto const& previous_kernel_vk = *private_inputs.previous_kernel.vk;
+    return CircuitShape{
+        .num_private_call_public_inputs = static_cast<uint32_t>(private_call_vk.num_public_inputs),
+        .private_call_contains_recursive_proof = private_call_vk.contains_recursive_proof,
+        .num_previous_kernel_public_inputs = static_cast<uint32_t>(previous_kernel_vk.num_public_inputs),
+        .previous_kernel_contains_recursive_proof = previous_kernel_vk.contains_recursive_proof,
+    };
+}
+
+/**
+ * @brief Proves the private kernel circuit, reusing the proving key cached for its variant and shape if there is one
+ *
+ * @details With a cached key, the circuit built only provides the witness: the key's selector and permutation
+ * polynomials stand in for computing them from the circuit again. A circuit whose structure differs from the one the
+ * key was computed from is not the circuit the key is for, and is instead proven from a full rebuild, as is a circuit
+ * with no cached key. A full rebuild caches the key it computes once its proof is done. Either way the proof is counted
+ * in the cache's stats (see `ProvingKeyCache::stats`).
+ *
+ * Proving writes the witness into the key, so proofs with the same cached key take turns (see `CachedProvingKey`).
+ */
+NT::Proof prove_private_kernel(PrivateKernelInputsInner<NT> const& private_inputs, bool first_iteration)
+{
+    auto& proving_key_cache = get_proving_key_cache();
+    auto const circuit =
+        first_iteration ? ProvingKeyCircuit::PRIVATE_KERNEL_INIT : ProvingKeyCircuit::PRIVATE_KERNEL_INNER;
+    auto const shape = private_kernel_shape(private_inputs);
+
+    auto const cached = proving_key_cache.get(circuit, shape);
+    if (cached.key) {
+        Composer witness_composer = Composer(cached.key, nullptr);
+        private_kernel_circuit(witness_composer, private_inputs, first_iteration);
+        if (circuit_structure_hash(witness_composer) == cached.structure_hash) {
+            proving_key_cache.record_proof(true);
+            CacheLock const lock(*cached.prover_mutex);
+            auto witness_prover = witness_composer.create_prover();
+            return witness_prover.construct_proof();
+        }
+    }
+
+    proving_key_cache.record_proof(false);
+    Composer private_kernel_composer = Composer(aztec3::utils::get_crs_factory());
+    private_kernel_circuit(private_kernel_composer, private_inputs, first_iteration);
+    auto const structure_hash = circuit_structure_hash(private_kernel_composer);
+    // the prover is created once the circuit is built, as it computes the key and the witness from it
+    auto private_kernel_prover = private_kernel_composer.create_prover();
+    NT::Proof const private_kernel_proof = private_kernel_prover.construct_proof();
+    // only shared once this proof is done writing its witness into the key
+    proving_key_cache.put(circuit,
+                          shape,
+                          { .key = private_kernel_composer.compute_proving_key(),
+                            .vk = private_kernel_composer.compute_verification_key(),
+                            .num_gates = private_kernel_composer.num_gates,
+                            .structure_hash = structure_hash });
+    return private_kernel_proof;
+}
+
+/**
+ * @brief Simulates the initial private kernel on `composer`, returning what `private_kernel__sim_init` returns
+ */
+uint8_t* sim_private_kernel_init(DummyComposer& composer,
+                                 uint8_t const* signed_tx_request_buf,
+                                 uint8_t const* private_call_buf,
+                                 size_t* private_kernel_public_inputs_size_out,
+                                 uint8_t const** private_kernel_public_inputs_buf)
+{
+    auto const& private_inputs = read_private_kernel_inputs_init(signed_tx_request_buf, private_call_buf);
+
+    auto public_inputs = native_private_kernel_circuit_initial(composer, private_inputs);
+
+    return serialize_to_malloc_buffer(
+        composer, public_inputs, private_kernel_public_inputs_size_out, private_kernel_public_inputs_buf);
+}
+
+/**
+ * @brief Simulates an inner private kernel on `composer`, returning what `private_kernel__sim_inner` returns
+ */
+uint8_t* sim_private_kernel_inner(DummyComposer& composer,
+                                  uint8_t const* previous_kernel_buf,
+                                  uint8_t const* private_call_buf,
+                                  size_t* private_kernel_public_inputs_size_out,
+                                  uint8_t const** private_kernel_public_inputs_buf)
+{
+    auto const& private_inputs = read_private_kernel_inputs_inner(previous_kernel_buf, private_call_buf);
+
+    auto public_inputs = native_private_kernel_circuit_inner(composer, private_inputs);
+
+    return serialize_to_malloc_buffer(
+        composer, public_inputs, private_kernel_public_inputs_size_out, private_kernel_public_inputs_buf);
+}
 
 }  // namespace
 
 // WASM Cbinds
 
-// TODO(dbanks12): might be able to get rid of proving key buffer
+/**
+ * @brief Serializes the private kernel proving keys computed or loaded so far (see `ProvingKeyCache`)
+ * @details A key is computed by the first proof of each variant and shape of the kernel, so before any proof the
+ * buffer holds no keys. Passing the buffer to `private_kernel__set_proving_keys` (e.g. in a later process) saves
+ * recomputing them.
+ * @return the size of the buffer
+ */
 WASM_EXPORT size_t private_kernel__init_proving_key(uint8_t const** pk_buf)
 {
-    std::vector<uint8_t> pk_vec(42, 0);
+    std::vector<uint8_t> const pk_vec = get_proving_key_cache().to_buffer();
 
     auto* raw_buf = (uint8_t*)malloc(pk_vec.size());
     memcpy(raw_buf, (void*)pk_vec.data(), pk_vec.size());
@@ -39,15 +206,71 @@ WASM_EXPORT size_t private_kernel__init_proving_key(uint8_t const** pk_buf)
     return pk_vec.size();
 }
 
-WASM_EXPORT size_t private_kernel__init_verification_key(uint8_t const* pk_buf, uint8_t const** vk_buf)
+/**
+ * @brief Adds the private kernel proving keys serialized by `private_kernel__init_proving_key`, replacing any held for
+ * the same variants and shapes
+ * @details Called once (e.g. at startup) rather than per proof: deserializing the keys is a large part of their cost.
+ * @return the number of keys added: 0 if `pk_buf` holds no keys in the current format
+ */
+WASM_EXPORT size_t private_kernel__set_proving_keys(uint8_t const* pk_buf)
 {
-    (void)pk_buf;
+    return get_proving_key_cache().from_buffer(pk_buf);
+}
 
-    // TODO(dbanks12) actual verification key?
-    // NT:VKData vk_data = { 0 };
+/**
+ * @brief Writes the private kernel proving keys computed or loaded so far to the directory `dir`
+ * @return the number of keys written
+ */
+WASM_EXPORT size_t private_kernel__save_proving_keys(char const* dir)
+{
+    return get_proving_key_cache().save(dir);
+}
 
-    std::vector<uint8_t> vk_vec(42, 0);
-    // write(vk_vec, vk_data);
+/**
+ * @brief Loads the private kernel proving keys written to the directory `dir` by `private_kernel__save_proving_keys`,
+ * memory-mapping their polynomials rather than reading them in
+ * @return the number of keys loaded: 0 if `dir` holds no keys in the current format
+ */
+WASM_EXPORT size_t private_kernel__load_proving_keys(char const* dir)
+{
+    return get_proving_key_cache().load(dir);
+}
+
+#ifndef __wasm__
+/**
+ * @brief Makes every later proof map its CRS points from the prepared file at `prepared_path` (prepared from the
+ * transcript in `transcript_dir` on first use) rather than reading them into memory
+ * @details See `MmapCrsFactory`. Call it before the first proof.
+ */
+WASM_EXPORT void private_kernel__init_mmap_crs(char const* transcript_dir, char const* prepared_path)
+{
+    aztec3::utils::init_mmap_crs_factory(transcript_dir, prepared_path);
+}
+#endif
+
+/**
+ * @brief Serializes the `verification_key_data` of the initial (`first_iteration`) or inner private kernel, for
+ * `private_kernel__verify_proof`
+ * @details Taken from the kernel's cached proving key (see `ProvingKeyCache::get_verification_key`), so there is one
+ * once the kernel has been proven, or its keys set or loaded. Until then the size returned is 0 and no buffer is
+ * allocated.
+ * @return the size of the buffer
+ */
+WASM_EXPORT size_t private_kernel__init_verification_key(uint8_t const* pk_buf,
+                                                         bool first_iteration,
+                                                         uint8_t const** vk_buf)
+{
+    // as for `private_kernel__prove`, the keys are those loaded or computed so far
+    (void)pk_buf;
+
+    auto const vk = get_proving_key_cache().get_verification_key(
+        first_iteration ? ProvingKeyCircuit::PRIVATE_KERNEL_INIT : ProvingKeyCircuit::PRIVATE_KERNEL_INNER);
+    if (vk == nullptr) {
+        *vk_buf = nullptr;
+        return 0;
+    }
+    std::vector<uint8_t> vk_vec;
+    write(vk_vec, *vk);
 
     auto* raw_buf = (uint8_t*)malloc(vk_vec.size());
     memcpy(raw_buf, (void*)vk_vec.data(), vk_vec.size());
@@ -58,6 +281,16 @@ WASM_EXPORT size_t private_kernel__init_verification_key(uint8_t const* pk_buf,
 
 CBIND(private_kernel__dummy_previous_kernel, []() { return dummy_previous_kernel(); });
 
+/**
+ * @brief Opts in to (or out of) skipping the contract tree membership checks of private calls whose function and
+ * contract leaves were already checked under the same historic contract tree root
+ * @return the hit/miss counters of the membership cache so far
+ */
+CBIND(private_kernel__set_contract_membership_cache_enabled, [](bool enabled) {
+    set_contract_membership_cache_enabled(enabled);
+    return get_contract_membership_cache_stats();
+});
+
 // TODO(dbanks12): comment about how public_inputs is a confusing name
 // returns size of public inputs
 WASM_EXPORT uint8_t* private_kernel__sim_init(uint8_t const* signed_tx_request_buf,
@@ -66,29 +299,30 @@ WASM_EXPORT uint8_t* private_kernel__sim_init(uint8_t const* signed_tx_request_b
                                               uint8_t const** private_kernel_public_inputs_buf)
 {
     DummyComposer composer = DummyComposer("private_kernel__sim_init");
+    return sim_private_kernel_init(composer,
+                                   signed_tx_request_buf,
+                                   private_call_buf,
+                                   private_kernel_public_inputs_size_out,
+                                   private_kernel_public_inputs_buf);
+}
 
-    PrivateCallData<NT> private_call_data;
-    read(private_call_buf, private_call_data);
-
-    SignedTxRequest<NT> signed_tx_request;
-    read(signed_tx_request_buf, signed_tx_request);
-
-    PrivateKernelInputsInit<NT> const private_inputs = PrivateKernelInputsInit<NT>{
-        .signed_tx_request = signed_tx_request,
-        .private_call = private_call_data,
-    };
-
-    auto public_inputs = native_private_kernel_circuit_initial(composer, private_inputs);
-
-    // serialize public inputs to bytes vec
-    std::vector<uint8_t> public_inputs_vec;
-    write(public_inputs_vec, public_inputs);
-    // copy public inputs to output buffer
-    auto* raw_public_inputs_buf = (uint8_t*)malloc(public_inputs_vec.size());
-    memcpy(raw_public_inputs_buf, (void*)public_inputs_vec.data(), public_inputs_vec.size());
-    *private_kernel_public_inputs_buf = raw_public_inputs_buf;
-    *private_kernel_public_inputs_size_out = public_inputs_vec.size();
-    return composer.alloc_and_serialize_first_failure();
+/**
+ * @brief As `private_kernel__sim_init`, but in fail-fast mode: the circuit skips its remaining stages once an
+ * assertion has failed (see `DummyComposer::should_stop`)
+ * @details The returned failure is the same. Only the follow-on failures and the outputs of the skipped stages are
+ * lost, so this is for callers which only need to know whether (and why) the inputs are invalid.
+ */
+WASM_EXPORT uint8_t* private_kernel__sim_init_fail_fast(uint8_t const* signed_tx_request_buf,
+                                                        uint8_t const* private_call_buf,
+                                                        size_t* private_kernel_public_inputs_size_out,
+                                                        uint8_t const** private_kernel_public_inputs_buf)
+{
+    DummyComposer composer = DummyComposer("private_kernel__sim_init_fail_fast", true);
+    return sim_private_kernel_init(composer,
+                                   signed_tx_request_buf,
+                                   private_call_buf,
+                                   private_kernel_public_inputs_size_out,
+                                   private_kernel_public_inputs_buf);
 }
 
 WASM_EXPORT uint8_t* private_kernel__sim_inner(uint8_t const* previous_kernel_buf,
@@ -97,28 +331,148 @@ WASM_EXPORT uint8_t* private_kernel__sim_inner(uint8_t const* previous_kernel_bu
                                                uint8_t const** private_kernel_public_inputs_buf)
 {
     DummyComposer composer = DummyComposer("private_kernel__sim_inner");
-    PrivateCallData<NT> private_call_data;
-    read(private_call_buf, private_call_data);
+    return sim_private_kernel_inner(composer,
+                                    previous_kernel_buf,
+                                    private_call_buf,
+                                    private_kernel_public_inputs_size_out,
+                                    private_kernel_public_inputs_buf);
+}
 
-    PreviousKernelData<NT> previous_kernel;
-    read(previous_kernel_buf, previous_kernel);
+/**
+ * @brief As `private_kernel__sim_inner`, in fail-fast mode (see `private_kernel__sim_init_fail_fast`)
+ */
+WASM_EXPORT uint8_t* private_kernel__sim_inner_fail_fast(uint8_t const* previous_kernel_buf,
+                                                         uint8_t const* private_call_buf,
+                                                         size_t* private_kernel_public_inputs_size_out,
+                                                         uint8_t const** private_kernel_public_inputs_buf)
+{
+    DummyComposer composer = DummyComposer("private_kernel__sim_inner_fail_fast", true);
+    return sim_private_kernel_inner(composer,
+                                    previous_kernel_buf,
+                                    private_call_buf,
+                                    private_kernel_public_inputs_size_out,
+                                    private_kernel_public_inputs_buf);
+}
 
-    PrivateKernelInputsInner<NT> const private_inputs = PrivateKernelInputsInner<NT>{
-        .previous_kernel = previous_kernel,
-        .private_call = private_call_data,
-    };
+/**
+ * @brief As `private_kernel__sim_init`, but the public inputs are returned in the sparse encoding of
+ * `write_sparse`, which records runs of empty array items compactly
+ * @details `abis__kernel_circuit_public_inputs_from_sparse` converts them back to the usual encoding.
+ */
+WASM_EXPORT uint8_t* private_kernel__sim_init_sparse(uint8_t const* signed_tx_request_buf,
+                                                     uint8_t const* private_call_buf,
+                                                     size_t* private_kernel_public_inputs_size_out,
+                                                     uint8_t const** private_kernel_public_inputs_buf)
+{
+    DummyComposer composer = DummyComposer("private_kernel__sim_init_sparse");
+
+    auto const& private_inputs = read_private_kernel_inputs_init(signed_tx_request_buf, private_call_buf);
+
+    auto public_inputs = native_private_kernel_circuit_initial(composer, private_inputs);
+
+    return serialize_to_malloc_buffer<OutputEncoding::SPARSE>(
+        composer, public_inputs, private_kernel_public_inputs_size_out, private_kernel_public_inputs_buf);
+}
+
+/**
+ * @brief As `private_kernel__sim_inner`, but both the previous kernel's public inputs and the returned public inputs
+ * are in the sparse encoding (see `private_kernel__sim_init_sparse`)
+ */
+WASM_EXPORT uint8_t* private_kernel__sim_inner_sparse(uint8_t const* previous_kernel_buf,
+                                                      uint8_t const* private_call_buf,
+                                                      size_t* private_kernel_public_inputs_size_out,
+                                                      uint8_t const** private_kernel_public_inputs_buf)
+{
+    DummyComposer composer = DummyComposer("private_kernel__sim_inner_sparse");
+
+    auto const& private_inputs = read_private_kernel_inputs_inner_sparse(previous_kernel_buf, private_call_buf);
 
     auto public_inputs = native_private_kernel_circuit_inner(composer, private_inputs);
 
-    // serialize public inputs to bytes vec
-    std::vector<uint8_t> public_inputs_vec;
-    write(public_inputs_vec, public_inputs);
-    // copy public inputs to output buffer
-    auto* raw_public_inputs_buf = (uint8_t*)malloc(public_inputs_vec.size());
-    memcpy(raw_public_inputs_buf, (void*)public_inputs_vec.data(), public_inputs_vec.size());
-    *private_kernel_public_inputs_buf = raw_public_inputs_buf;
-    *private_kernel_public_inputs_size_out = public_inputs_vec.size();
-    return composer.alloc_and_serialize_first_failure();
+    return serialize_to_malloc_buffer<OutputEncoding::SPARSE>(
+        composer, public_inputs, private_kernel_public_inputs_size_out, private_kernel_public_inputs_buf);
+}
+
+/**
+ * @brief As `private_kernel__sim_init`, but the public inputs and the failure (if any) are serialized straight into
+ * the calling thread's scratch arena
+ * @details The returned pointers stay valid until the next `*_scratch` call on this thread or
+ * `scratch_arena__release`, and must not be freed.
+ */
+WASM_EXPORT uint8_t const* private_kernel__sim_init_scratch(uint8_t const* signed_tx_request_buf,
+                                                            uint8_t const* private_call_buf,
+                                                            size_t* private_kernel_public_inputs_size_out,
+                                                            uint8_t const** private_kernel_public_inputs_buf)
+{
+    DummyComposer composer = DummyComposer("private_kernel__sim_init_scratch");
+
+    auto const& private_inputs = read_private_kernel_inputs_init(signed_tx_request_buf, private_call_buf);
+
+    auto const public_inputs = native_private_kernel_circuit_initial(composer, private_inputs);
+
+    return serialize_to_scratch_arena(
+        composer, public_inputs, private_kernel_public_inputs_size_out, private_kernel_public_inputs_buf);
+}
+
+/**
+ * @brief As `private_kernel__sim_inner`, but the outputs are serialized into the calling thread's scratch arena (see
+ * `private_kernel__sim_init_scratch`)
+ */
+WASM_EXPORT uint8_t const* private_kernel__sim_inner_scratch(uint8_t const* previous_kernel_buf,
+                                                             uint8_t const* private_call_buf,
+                                                             size_t* private_kernel_public_inputs_size_out,
+                                                             uint8_t const** private_kernel_public_inputs_buf)
+{
+    DummyComposer composer = DummyComposer("private_kernel__sim_inner_scratch");
+
+    auto const& private_inputs = read_private_kernel_inputs_inner(previous_kernel_buf, private_call_buf);
+
+    auto const public_inputs = native_private_kernel_circuit_inner(composer, private_inputs);
+
+    return serialize_to_scratch_arena(
+        composer, public_inputs, private_kernel_public_inputs_size_out, private_kernel_public_inputs_buf);
+}
+
+/**
+ * @brief Frees the calling thread's scratch arena, which holds the outputs of the last `*_scratch` c_bind (of any
+ * circuit) called on it
+ * @details Only needed to give the memory back: each `*_scratch` call reuses the arena as it is.
+ */
+WASM_EXPORT void scratch_arena__release()
+{
+    get_scratch_arena().release();
+}
+
+/**
+ * @brief Frees the calling thread's input slots, which hold the inputs last decoded by each sim c_bind (of any
+ * circuit) called on it
+ * @details Only needed to give the memory back: the next sim call on the thread allocates its slot again.
+ */
+WASM_EXPORT void input_slots__release()
+{
+    release_input_slots();
+}
+
+/**
+ * @brief Simulates the inner private kernel circuit over many independent transactions at once
+ * @details Takes a length-prefixed vector of PrivateKernelInputsInner and writes a length-prefixed vector of public
+ * inputs. The items run concurrently when multithreading is enabled.
+ * @return a length-prefixed vector of CircuitErrors with one entry per input (NO_ERROR on success), in input order
+ */
+WASM_EXPORT uint8_t* private_kernel__sim_inner_batch(uint8_t const* private_inputs_buf,
+                                                     size_t* private_kernel_public_inputs_size_out,
+                                                     uint8_t const** private_kernel_public_inputs_buf)
+{
+    std::vector<PrivateKernelInputsInner<NT>> private_inputs;
+    read(private_inputs_buf, private_inputs);
+
+    auto const batch_result =
+        simulate_batch("private_kernel__sim_inner_batch", private_inputs, native_private_kernel_circuit_inner);
+
+    *private_kernel_public_inputs_buf =
+        write_to_malloc_buffer(batch_result.outputs, private_kernel_public_inputs_size_out);
+    size_t circuit_failures_size = 0;
+    return write_to_malloc_buffer(batch_result.errors, &circuit_failures_size);
 }
 
 // TODO(jeanmon): We currently only support inner variant because the circuit version
@@ -132,10 +486,9 @@ WASM_EXPORT size_t private_kernel__prove(uint8_t const* signed_tx_request_buf,
                                          bool first_iteration,
                                          uint8_t const** proof_data_buf)
 {
-    // TODO(dbanks12) might be able to get rid of proving key buffer
-    // TODO(dbanks12) do we want to accept it or just get it from our factory?
-    (void)pk_buf;  // unused
-    auto crs_factory = barretenberg::srs::get_crs_factory();
+    // the keys are loaded once, by `private_kernel__set_proving_keys` or `private_kernel__load_proving_keys`, rather
+    // than per proof: callers pass any pointer (e.g. TS passes an unwritten offset)
+    (void)pk_buf;
 
     SignedTxRequest<NT> signed_tx_request;
     read(signed_tx_request_buf, signed_tx_request);
@@ -165,13 +518,7 @@ WASM_EXPORT size_t private_kernel__prove(uint8_t const* signed_tx_request_buf,
         .private_call = private_call_data,
     };
 
-    Composer private_kernel_composer = Composer(crs_factory);
-    auto private_kernel_prover = private_kernel_composer.create_prover();
-
-    KernelCircuitPublicInputs<NT> public_inputs;
-    public_inputs = private_kernel_circuit(private_kernel_composer, private_inputs, first_iteration);
-    NT::Proof private_kernel_proof;
-    private_kernel_proof = private_kernel_prover.construct_proof();
+    NT::Proof const private_kernel_proof = prove_private_kernel(private_inputs, first_iteration);
 
     // copy proof data to output buffer
     auto* raw_proof_buf = (uint8_t*)malloc(private_kernel_proof.proof_data.size());
@@ -183,10 +530,87 @@ WASM_EXPORT size_t private_kernel__prove(uint8_t const* signed_tx_request_buf,
     return private_kernel_proof.proof_data.size();
 }
 
+/**
+ * @brief Verifies a private kernel proof natively
+ * @param vk_buf the serialized `verification_key_data` of the kernel circuit the proof is of, as
+ * `private_kernel__init_verification_key` returns it
+ * @param proof the proof's bytes
+ * @param length the number of bytes of `proof`
+ * @return 1 if the proof verifies, else 0
+ */
 WASM_EXPORT size_t private_kernel__verify_proof(uint8_t const* vk_buf, uint8_t const* proof, uint32_t length)
 {
-    (void)vk_buf;  // unused
-    (void)proof;   // unused
-    (void)length;  // unused
-    return 1U;
+    NT::VKData vk_data;
+    read(vk_buf, vk_data);
+    auto const vk =
+        std::make_shared<NT::VK>(std::move(vk_data), aztec3::utils::get_crs_factory()->get_verifier_crs());
+    NT::Proof const kernel_proof{ .proof_data = std::vector<uint8_t>(proof, proof + length) };
+    return verify_kernel_proof(vk, kernel_proof) ? 1U : 0U;
+}
+
+/**
+ * @brief As `private_kernel__prove`, but emits a mock proof of the kernel's public inputs instead of proving it, for
+ * load testing without provers
+ *
+ * @details The kernel is simulated natively, and the proof is the mock kernel circuit's mock proof of the resulting
+ * public inputs (see `mock/mock_kernel_proof.hpp`): it has the size and layout of a real kernel proof, and is accepted
+ * by `private_kernel__verify_mock_proof` against the key of `private_kernel__init_mock_verification_key`. A kernel that
+ * fails simulation has no proof, as it would have none if proven: the size returned is 0 and no buffer is allocated.
+ * @return the size of the proof data
+ */
+WASM_EXPORT size_t private_kernel__prove_mock(uint8_t const* signed_tx_request_buf,
+                                              uint8_t const* previous_kernel_buf,
+                                              uint8_t const* private_call_buf,
+                                              bool first_iteration,
+                                              uint8_t const** proof_data_buf)
+{
+    DummyComposer composer = DummyComposer("private_kernel__prove_mock");
+
+    auto const public_inputs =
+        first_iteration
+            ? native_private_kernel_circuit_initial(
+                  composer, read_private_kernel_inputs_init(signed_tx_request_buf, private_call_buf))
+            : native_private_kernel_circuit_inner(
+                  composer, read_private_kernel_inputs_inner(previous_kernel_buf, private_call_buf));
+    if (composer.failed()) {
+        *proof_data_buf = nullptr;
+        return 0;
+    }
+
+    NT::Proof const mock_proof = mock_kernel_proof(build_mock_kernel_circuit(public_inputs).public_inputs_buf);
+
+    auto* raw_proof_buf = (uint8_t*)malloc(mock_proof.proof_data.size());
+    memcpy(raw_proof_buf, (void*)mock_proof.proof_data.data(), mock_proof.proof_data.size());
+    *proof_data_buf = raw_proof_buf;
+    return mock_proof.proof_data.size();
+}
+
+/**
+ * @brief Serializes the `verification_key_data` of every mock kernel proof
+ * @return the size of the buffer
+ */
+WASM_EXPORT size_t private_kernel__init_mock_verification_key(uint8_t const** vk_buf)
+{
+    std::vector<uint8_t> vk_vec;
+    write(vk_vec, mock_kernel_vk_data());
+
+    auto* raw_buf = (uint8_t*)malloc(vk_vec.size());
+    memcpy(raw_buf, (void*)vk_vec.data(), vk_vec.size());
+    *vk_buf = raw_buf;
+
+    return vk_vec.size();
+}
+
+/**
+ * @brief As `private_kernel__verify_proof`, for a mock proof: checks it is the mock proof of the public inputs it
+ * holds, without any curve arithmetic (or a CRS)
+ * @return 1 if the proof is accepted, else 0
+ */
+WASM_EXPORT size_t private_kernel__verify_mock_proof(uint8_t const* vk_buf, uint8_t const* proof, uint32_t length)
+{
+    NT::VKData vk_data;
+    read(vk_buf, vk_data);
+    auto const vk = std::make_shared<NT::VK>(std::move(vk_data), nullptr);
+    NT::Proof const kernel_proof{ .proof_data = std::vector<uint8_t>(proof, proof + length) };
+    return verify_mock_kernel_proof(vk, kernel_proof) ? 1U : 0U;
 }
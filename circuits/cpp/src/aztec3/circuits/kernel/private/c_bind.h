@@ -5,8 +5,17 @@
 #include <cstdint>
 
 WASM_EXPORT size_t private_kernel__init_proving_key(uint8_t const** pk_buf);
-WASM_EXPORT size_t private_kernel__init_verification_key(uint8_t const* pk_buf, uint8_t const** vk_buf);
+WASM_EXPORT size_t private_kernel__set_proving_keys(uint8_t const* pk_buf);
+WASM_EXPORT size_t private_kernel__save_proving_keys(char const* dir);
+WASM_EXPORT size_t private_kernel__load_proving_keys(char const* dir);
+#ifndef __wasm__
+WASM_EXPORT void private_kernel__init_mmap_crs(char const* transcript_dir, char const* prepared_path);
+#endif
+WASM_EXPORT size_t private_kernel__init_verification_key(uint8_t const* pk_buf,
+                                                         bool first_iteration,
+                                                         uint8_t const** vk_buf);
 CBIND_DECL(private_kernel__dummy_previous_kernel);
+CBIND_DECL(private_kernel__set_contract_membership_cache_enabled);
 WASM_EXPORT uint8_t* private_kernel__sim_init(uint8_t const* signed_tx_request_buf,
                                               uint8_t const* private_call_buf,
                                               size_t* private_kernel_public_inputs_size_out,
@@ -15,6 +24,35 @@ WASM_EXPORT uint8_t* private_kernel__sim_inner(uint8_t const* previous_kernel_bu
                                                uint8_t const* private_call_buf,
                                                size_t* private_kernel_public_inputs_size_out,
                                                uint8_t const** private_kernel_public_inputs_buf);
+WASM_EXPORT uint8_t* private_kernel__sim_init_fail_fast(uint8_t const* signed_tx_request_buf,
+                                                        uint8_t const* private_call_buf,
+                                                        size_t* private_kernel_public_inputs_size_out,
+                                                        uint8_t const** private_kernel_public_inputs_buf);
+WASM_EXPORT uint8_t* private_kernel__sim_inner_fail_fast(uint8_t const* previous_kernel_buf,
+                                                         uint8_t const* private_call_buf,
+                                                         size_t* private_kernel_public_inputs_size_out,
+                                                         uint8_t const** private_kernel_public_inputs_buf);
+WASM_EXPORT uint8_t* private_kernel__sim_init_sparse(uint8_t const* signed_tx_request_buf,
+                                                     uint8_t const* private_call_buf,
+                                                     size_t* private_kernel_public_inputs_size_out,
+                                                     uint8_t const** private_kernel_public_inputs_buf);
+WASM_EXPORT uint8_t* private_kernel__sim_inner_sparse(uint8_t const* previous_kernel_buf,
+                                                      uint8_t const* private_call_buf,
+                                                      size_t* private_kernel_public_inputs_size_out,
+                                                      uint8_t const** private_kernel_public_inputs_buf);
+WASM_EXPORT uint8_t const* private_kernel__sim_init_scratch(uint8_t const* signed_tx_request_buf,
+                                                            uint8_t const* private_call_buf,
+                                                            size_t* private_kernel_public_inputs_size_out,
+                                                            uint8_t const** private_kernel_public_inputs_buf);
+WASM_EXPORT uint8_t const* private_kernel__sim_inner_scratch(uint8_t const* previous_kernel_buf,
+                                                             uint8_t const* private_call_buf,
+                                                             size_t* private_kernel_public_inputs_size_out,
+                                                             uint8_t const** private_kernel_public_inputs_buf);
+WASM_EXPORT void scratch_arena__release();
+WASM_EXPORT void input_slots__release();
+WASM_EXPORT uint8_t* private_kernel__sim_inner_batch(uint8_t const* private_inputs_buf,
+                                                     size_t* private_kernel_public_inputs_size_out,
+                                                     uint8_t const** private_kernel_public_inputs_buf);
 WASM_EXPORT size_t private_kernel__prove(uint8_t const* signed_tx_request_buf,
                                          uint8_t const* previous_kernel_buf,
                                          uint8_t const* private_call_buf,
@@ -22,3 +60,10 @@ WASM_EXPORT size_t private_kernel__prove(uint8_t const* signed_tx_request_buf,
                                          bool first,
                                          uint8_t const** proof_data_buf);
 WASM_EXPORT size_t private_kernel__verify_proof(uint8_t const* vk_buf, uint8_t const* proof, uint32_t length);
+WASM_EXPORT size_t private_kernel__prove_mock(uint8_t const* signed_tx_request_buf,
+                                              uint8_t const* previous_kernel_buf,
+                                              uint8_t const* private_call_buf,
+                                              bool first_iteration,
+                                              uint8_t const** proof_data_buf);
+WASM_EXPORT size_t private_kernel__init_mock_verification_key(uint8_t const** vk_buf);
+WASM_EXPORT size_t private_kernel__verify_mock_proof(uint8_t const* vk_buf, uint8_t const* proof, uint32_t length);
@@ -0,0 +1,94 @@
+#include "common.hpp"
+#include "init.hpp"
+#include "testing_harness.hpp"
+
+#include "aztec3/constants.hpp"
+#include "aztec3/utils/circuit_errors.hpp"
+#include "aztec3/utils/dummy_composer.hpp"
+
+#include <barretenberg/barretenberg.hpp>
+
+#include <benchmark/benchmark.h>
+
+namespace {
+
+using aztec3::READ_REQUESTS_LENGTH;
+using aztec3::circuits::kernel::private_kernel::common_validate_read_requests;
+using aztec3::circuits::kernel::private_kernel::NT;
+using aztec3::circuits::kernel::private_kernel::testing_harness::get_random_reads;
+using aztec3::utils::CircuitErrorCode;
+using aztec3::utils::DummyComposer;
+
+/**
+ * @brief A passing assertion whose message stringifies two field elements, the way the read request check's does,
+ * built eagerly as before
+ */
+void eager_message_assert(benchmark::State& state)
+{
+    NT::fr const expected_root = NT::fr::random_element();
+    NT::fr const root = expected_root;
+    for (auto _ : state) {
+        DummyComposer composer = DummyComposer("eager_message_assert");
+        for (size_t i = 0; i < READ_REQUESTS_LENGTH; i++) {
+            composer.do_assert(
+                root == expected_root,
+                format("private data root mismatch at read_request[",
+                       i,
+                       "] - Expected root: ",
+                       expected_root,
+                       ", Read request gave root: ",
+                       root),
+                CircuitErrorCode::PRIVATE_KERNEL__READ_REQUEST_PRIVATE_DATA_ROOT_MISMATCH);
+        }
+        benchmark::DoNotOptimize(composer.failed());
+    }
+}
+BENCHMARK(eager_message_assert);
+
+/**
+ * @brief The same assertions with the message built only on failure
+ */
+void lazy_message_assert(benchmark::State& state)
+{
+    NT::fr const expected_root = NT::fr::random_element();
+    NT::fr const root = expected_root;
+    for (auto _ : state) {
+        DummyComposer composer = DummyComposer("lazy_message_assert");
+        for (size_t i = 0; i < READ_REQUESTS_LENGTH; i++) {
+            composer.do_assert(
+                root == expected_root,
+                [&]() {
+                    return format("private data root mismatch at read_request[",
+                                  i,
+                                  "] - Expected root: ",
+                                  expected_root,
+                                  ", Read request gave root: ",
+                                  root);
+                },
+                CircuitErrorCode::PRIVATE_KERNEL__READ_REQUEST_PRIVATE_DATA_ROOT_MISMATCH);
+        }
+        benchmark::DoNotOptimize(composer.failed());
+    }
+}
+BENCHMARK(lazy_message_assert);
+
+/**
+ * @brief The success path of the private kernel's read request check with every read request slot in use
+ */
+void validate_read_requests_success_path(benchmark::State& state)
+{
+    NT::fr const contract_address = NT::fr::random_element();
+    auto const [read_requests, read_request_membership_witnesses, root] =
+        get_random_reads(contract_address, static_cast<int>(READ_REQUESTS_LENGTH));
+    for (auto _ : state) {
+        DummyComposer composer = DummyComposer("validate_read_requests_success_path");
+        common_validate_read_requests(
+            composer, contract_address, read_requests, read_request_membership_witnesses, root);
+        benchmark::DoNotOptimize(composer.failed());
+    }
+}
+BENCHMARK(validate_read_requests_success_path);
+
+}  // namespace
+
+BENCHMARK_MAIN();
@@ -1,5 +1,6 @@
 #include "common.hpp"
 
+#include "contract_membership_cache.hpp"
 #include "init.hpp"
 
 #include "aztec3/circuits/abis/contract_deployment_data.hpp"
@@ -9,6 +10,7 @@
 #include "aztec3/circuits/abis/new_contract_data.hpp"
 #include "aztec3/circuits/abis/private_kernel/private_call_data.hpp"
 #include "aztec3/circuits/hash.hpp"
+#include "aztec3/circuits/vk_hash_cache.hpp"
 #include "aztec3/constants.hpp"
 #include "aztec3/utils/array.hpp"
 #include "aztec3/utils/dummy_composer.hpp"
@@ -43,9 +45,10 @@ void common_validate_call_stack(DummyComposer& composer, PrivateCallData<NT> con
         // Note: this assumes it's computationally infeasible to have `0` as a valid call_stack_item_hash.
         // Assumes `hash == 0` means "this stack item is empty".
         const auto calculated_hash = hash == 0 ? 0 : preimage.hash();
-        composer.do_assert(hash == calculated_hash,
-                           format("private_call_stack[", i, "] = ", hash, "; does not reconcile"),
-                           CircuitErrorCode::PRIVATE_KERNEL__PRIVATE_CALL_STACK_ITEM_HASH_MISMATCH);
+        composer.do_assert(
+            hash == calculated_hash,
+            [&]() { return format("private_call_stack[", i, "] = ", hash, "; does not reconcile"); },
+            CircuitErrorCode::PRIVATE_KERNEL__PRIVATE_CALL_STACK_ITEM_HASH_MISMATCH);
     }
 }
 
@@ -84,15 +87,18 @@ void common_validate_read_requests(DummyComposer& composer,
         const auto& witness = read_request_membership_witnesses[rr_idx];
         const auto& root_for_read_request = root_from_sibling_path<NT>(leaf, witness.leaf_index, witness.sibling_path);
 
-        composer.do_assert(root_for_read_request == historic_private_data_tree_root,
-                           format("private data root mismatch at read_request[",
-                                  rr_idx,
-                                  "] - ",
-                                  "Expected root: ",
-                                  historic_private_data_tree_root,
-                                  ", Read request gave root: ",
-                                  root_for_read_request),
-                           CircuitErrorCode::PRIVATE_KERNEL__READ_REQUEST_PRIVATE_DATA_ROOT_MISMATCH);
+        composer.do_assert(
+            root_for_read_request == historic_private_data_tree_root,
+            [&]() {
+                return format("private data root mismatch at read_request[",
+                              rr_idx,
+                              "] - ",
+                              "Expected root: ",
+                              historic_private_data_tree_root,
+                              ", Read request gave root: ",
+                              root_for_read_request);
+            },
+            CircuitErrorCode::PRIVATE_KERNEL__READ_REQUEST_PRIVATE_DATA_ROOT_MISMATCH);
     }
 }
 
@@ -203,8 +209,8 @@ void common_contract_logic(DummyComposer& composer,
     const auto& storage_contract_address = private_call_public_inputs.call_context.storage_contract_address;
     const auto& portal_contract_address = private_call.portal_contract_address;
 
-    const auto private_call_vk_hash =
-        stdlib::recursion::verification_key<CT::bn254>::compress_native(private_call.vk, GeneratorIndex::VK);
+    // the same few function vks come through every call, so their hashes are memoised
+    const auto private_call_vk_hash = compress_vk_native(private_call.vk);
 
     const auto is_contract_deployment = public_inputs.constants.tx_context.is_contract_deployment_tx;
 
@@ -255,6 +261,21 @@ void common_contract_logic(DummyComposer& composer,
 
         // The logic below ensures that the contract exists in the contracts tree
 
+        auto const& purported_contract_tree_root =
+            private_call.call_stack_item.public_inputs.historic_contract_tree_root;
+
+        // When the (opt-in) membership cache already holds these leaves under this root, the walks are skipped
+        auto const membership_key =
+            contract_membership_cache_key(storage_contract_address,
+                                          portal_contract_address,
+                                          private_call.call_stack_item.function_data.function_selector,
+                                          private_call_vk_hash,
+                                          private_call.acir_hash,
+                                          purported_contract_tree_root);
+        if (is_cached_contract_member(membership_key)) {
+            return;
+        }
+
         auto const& computed_function_tree_root =
             function_tree_root_from_siblings<NT>(private_call.call_stack_item.function_data.function_selector,
                                                  true,  // is_private
@@ -270,8 +291,9 @@ void common_contract_logic(DummyComposer& composer,
                                                  private_call.contract_leaf_membership_witness.leaf_index,
                                                  private_call.contract_leaf_membership_witness.sibling_path);
 
-        auto const& purported_contract_tree_root =
-            private_call.call_stack_item.public_inputs.historic_contract_tree_root;
+        if (computed_contract_tree_root == purported_contract_tree_root) {
+            cache_contract_member(membership_key);
+        }
 
         composer.do_assert(
             computed_contract_tree_root == purported_contract_tree_root,
@@ -0,0 +1,100 @@
+#include "contract_membership_cache.hpp"
+
+#include "init.hpp"
+
+#include "aztec3/utils/lru_cache.hpp"
+
+#include <atomic>
+#include <cstddef>
+
+namespace {
+
+using aztec3::circuits::kernel::private_kernel::CONTRACT_MEMBERSHIP_CACHE_CAPACITY;
+using aztec3::circuits::kernel::private_kernel::ContractMembershipCacheKey;
+using aztec3::utils::LruCache;
+
+struct ContractMembershipCacheKeyHash {
+    size_t operator()(ContractMembershipCacheKey const& key) const
+    {
+        // the fields are (close to) uniformly distributed, so mixing their lowest limbs is plenty
+        size_t hash = 0;
+        for (auto const& field : key) {
+            hash = hash * 31 + static_cast<size_t>(field.data[0]);
+        }
+        return hash;
+    }
+};
+
+using ContractMembershipCache = LruCache<ContractMembershipCacheKey, bool, ContractMembershipCacheKeyHash>;
+
+ContractMembershipCache& get_contract_membership_cache()
+{
+    static ContractMembershipCache cache(CONTRACT_MEMBERSHIP_CACHE_CAPACITY);
+    return cache;
+}
+
+// opt-in: a cache hit skips recomputing the membership of the call's contract, which callers may want to rule out
+std::atomic<bool> contract_membership_cache_enabled = false;
+
+}  // namespace
+
+namespace aztec3::circuits::kernel::private_kernel {
+
+ContractMembershipCacheKey contract_membership_cache_key(NT::address const& contract_address,
+                                                         NT::fr const& portal_contract_address,
+                                                         NT::uint32 function_selector,
+                                                         NT::fr const& vk_hash,
+                                                         NT::fr const& acir_hash,
+                                                         NT::fr const& historic_contract_tree_root)
+{
+    return {
+        contract_address.to_field(), portal_contract_address, NT::fr(function_selector), vk_hash, acir_hash,
+        historic_contract_tree_root,
+    };
+}
+
+/**
+ * @brief Turns the cache of proven contract/function memberships on or off (it is off by default)
+ * @details Turning it off does not drop the entries, so see `clear_contract_membership_cache`.
+ */
+void set_contract_membership_cache_enabled(bool enabled)
+{
+    contract_membership_cache_enabled = enabled;
+}
+
+bool is_contract_membership_cache_enabled()
+{
+    return contract_membership_cache_enabled;
+}
+
+/**
+ * @brief Whether the function and contract leaves described by `key` were already shown to be in the contract tree
+ * @return false whenever the cache is disabled
+ */
+bool is_cached_contract_member(ContractMembershipCacheKey const& key)
+{
+    return contract_membership_cache_enabled && get_contract_membership_cache().get(key).has_value();
+}
+
+/**
+ * @brief Records that the function and contract leaves described by `key` are in the contract tree
+ * @details Must only be called once the membership was actually checked. A no-op whenever the cache is disabled.
+ */
+void cache_contract_member(ContractMembershipCacheKey const& key)
+{
+    if (contract_membership_cache_enabled) {
+        get_contract_membership_cache().put(key, true);
+    }
+}
+
+void clear_contract_membership_cache()
+{
+    get_contract_membership_cache().clear();
+}
+
+CacheStats get_contract_membership_cache_stats()
+{
+    return get_contract_membership_cache().stats();
+}
+
+}  // namespace aztec3::circuits::kernel::private_kernel
\ No newline at end of file
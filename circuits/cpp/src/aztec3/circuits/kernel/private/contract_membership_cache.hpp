@@ -0,0 +1,44 @@
+#pragma once
+
+#include "init.hpp"
+
+#include "aztec3/utils/lru_cache.hpp"
+
+#include <array>
+#include <cstddef>
+
+namespace aztec3::circuits::kernel::private_kernel {
+
+using aztec3::utils::CacheStats;
+
+constexpr size_t CONTRACT_MEMBERSHIP_CACHE_CAPACITY = 1024;
+
+/**
+ * @brief Everything the function leaf and contract leaf of a private call are built from, plus the contract tree root
+ * they were shown to be members of:
+ * (contract address, portal contract address, function selector, vk hash, acir hash, historic contract tree root)
+ * @details The leaf indices and sibling paths are not part of the key: once a leaf is known to be in the tree with a
+ * given root, any witness for it proves the same thing.
+ */
+using ContractMembershipCacheKey = std::array<NT::fr, 6>;
+
+ContractMembershipCacheKey contract_membership_cache_key(NT::address const& contract_address,
+                                                         NT::fr const& portal_contract_address,
+                                                         NT::uint32 function_selector,
+                                                         NT::fr const& vk_hash,
+                                                         NT::fr const& acir_hash,
+                                                         NT::fr const& historic_contract_tree_root);
+
+void set_contract_membership_cache_enabled(bool enabled);
+
+bool is_contract_membership_cache_enabled();
+
+bool is_cached_contract_member(ContractMembershipCacheKey const& key);
+
+void cache_contract_member(ContractMembershipCacheKey const& key);
+
+void clear_contract_membership_cache();
+
+CacheStats get_contract_membership_cache_stats();
+
+}  // namespace aztec3::circuits::kernel::private_kernel
\ No newline at end of file
@@ -1,3 +1,4 @@
+#include "contract_membership_cache.hpp"
 #include "init.hpp"
 #include "native_private_kernel_circuit_init.hpp"
 #include "native_private_kernel_circuit_inner.hpp"
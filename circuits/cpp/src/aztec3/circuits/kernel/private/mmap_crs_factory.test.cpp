@@ -0,0 +1,101 @@
+#include "init.hpp"
+
+#include "aztec3/circuits/abis/kernel_circuit_public_inputs.hpp"
+#include "aztec3/circuits/mock/mock_kernel_circuit.hpp"
+#include "aztec3/utils/mmap_crs_factory.hpp"
+
+#include <barretenberg/barretenberg.hpp>
+
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <memory>
+#include <string>
+
+#ifndef __wasm__
+
+namespace {
+
+using aztec3::circuits::abis::KernelCircuitPublicInputs;
+using aztec3::circuits::mock::mock_kernel_circuit;
+using aztec3::utils::MmapCrsFactory;
+
+constexpr char const* TRANSCRIPT_DIR = "../barretenberg/cpp/srs_db/ignition";
+
+}  // namespace
+
+namespace aztec3::circuits::kernel::private_kernel {
+
+class mmap_crs_factory_tests : public ::testing::Test {
+  protected:
+    void SetUp() override
+    {
+        prepared_path = (std::filesystem::temp_directory_path() /
+                         ("mmap_crs_factory_tests_" + std::to_string(getpid()) + ".crs"))
+                            .string();
+        std::filesystem::remove(prepared_path);
+    }
+
+    void TearDown() override { std::filesystem::remove(prepared_path); }
+
+    std::string prepared_path;
+};
+
+TEST_F(mmap_crs_factory_tests, mapped_points_match_transcript_points)
+{
+    constexpr size_t degree = 1024;
+    MmapCrsFactory mmap_factory(TRANSCRIPT_DIR, prepared_path);
+    barretenberg::srs::factories::FileCrsFactory file_factory(TRANSCRIPT_DIR);
+
+    auto mapped_crs = mmap_factory.get_prover_crs(degree);
+    auto file_crs = file_factory.get_prover_crs(degree);
+    ASSERT_EQ(mapped_crs->get_monomial_size(), degree);
+
+    auto* const mapped_points = mapped_crs->get_monomial_points();
+    auto* const file_points = file_crs->get_monomial_points();
+    // each point and its endomorphism image
+    for (size_t i = 0; i < 2 * degree; i++) {
+        EXPECT_EQ(mapped_points[i], file_points[i]);
+    }
+}
+
+TEST_F(mmap_crs_factory_tests, prepared_file_is_reused_and_regrown)
+{
+    {
+        MmapCrsFactory first_factory(TRANSCRIPT_DIR, prepared_path);
+        first_factory.get_prover_crs(1024);
+    }
+    auto const prepared_size = std::filesystem::file_size(prepared_path);
+    auto const prepared_time = std::filesystem::last_write_time(prepared_path);
+
+    // as another process would: a smaller degree is mapped from the file already prepared
+    MmapCrsFactory second_factory(TRANSCRIPT_DIR, prepared_path);
+    auto small_crs = second_factory.get_prover_crs(512);
+    EXPECT_EQ(small_crs->get_monomial_size(), 512U);
+    EXPECT_EQ(std::filesystem::last_write_time(prepared_path), prepared_time);
+
+    // a larger one prepares the file again, while the CRS handed out before stays mapped
+    auto large_crs = second_factory.get_prover_crs(4096);
+    EXPECT_GT(std::filesystem::file_size(prepared_path), prepared_size);
+    EXPECT_EQ(small_crs->get_monomial_points()[0], large_crs->get_monomial_points()[0]);
+}
+
+TEST_F(mmap_crs_factory_tests, proof_with_mapped_crs_verifies)
+{
+    auto mmap_factory = std::make_shared<MmapCrsFactory>(TRANSCRIPT_DIR, prepared_path);
+
+    Composer prover_composer = Composer(mmap_factory);
+    mock_kernel_circuit(prover_composer, KernelCircuitPublicInputs<NT>{});
+    auto prover = prover_composer.create_prover();
+    auto const proof = prover.construct_proof();
+
+    auto file_factory = std::make_shared<barretenberg::srs::factories::FileCrsFactory>(TRANSCRIPT_DIR);
+    Composer verifier_composer = Composer(file_factory);
+    mock_kernel_circuit(verifier_composer, KernelCircuitPublicInputs<NT>{});
+    auto verifier = verifier_composer.create_verifier();
+    EXPECT_TRUE(verifier.verify_proof(proof));
+}
+
+}  // namespace aztec3::circuits::kernel::private_kernel
+
+#endif
@@ -0,0 +1,112 @@
+#include "c_bind.h"
+#include "init.hpp"
+#include "utils.hpp"
+
+#include "aztec3/circuits/abis/kernel_circuit_public_inputs.hpp"
+#include "aztec3/circuits/kernel_proof_verifier.hpp"
+#include "aztec3/circuits/mock/mock_kernel_proof.hpp"
+
+#include <barretenberg/barretenberg.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace {
+
+using aztec3::circuits::expected_kernel_proof_size;
+using aztec3::circuits::is_well_formed_kernel_proof;
+using aztec3::circuits::verify_kernel_proof;
+using aztec3::circuits::abis::KernelCircuitPublicInputs;
+using aztec3::circuits::kernel::private_kernel::utils::dummy_previous_kernel;
+using aztec3::circuits::mock::mock_previous_kernel;
+using aztec3::circuits::mock::verify_mock_kernel_proof;
+using aztec3::circuits::mock::verify_mock_kernel_proofs;
+
+}  // namespace
+
+namespace aztec3::circuits::kernel::private_kernel {
+
+class mock_kernel_proof_tests : public ::testing::Test {
+  protected:
+    static void SetUpTestSuite() { barretenberg::srs::init_crs_factory("../barretenberg/cpp/srs_db/ignition"); }
+};
+
+TEST_F(mock_kernel_proof_tests, mock_proof_is_laid_out_like_a_real_one)
+{
+    auto const mock_kernel = mock_previous_kernel(KernelCircuitPublicInputs<NT>{});
+    // proven from the same (empty) public inputs
+    auto const real_kernel = dummy_previous_kernel(true);
+
+    EXPECT_TRUE(is_well_formed_kernel_proof(mock_kernel.vk, mock_kernel.proof));
+    EXPECT_EQ(mock_kernel.vk->num_public_inputs, real_kernel.vk->num_public_inputs);
+    EXPECT_EQ(mock_kernel.proof.proof_data.size(), expected_kernel_proof_size(real_kernel.vk->num_public_inputs));
+    EXPECT_EQ(mock_kernel.proof.proof_data.size(), real_kernel.proof.proof_data.size());
+
+    // the proof starts with its public inputs, which are those of the real proof
+    auto const public_inputs_size = real_kernel.vk->num_public_inputs * sizeof(NT::fr);
+    EXPECT_TRUE(std::equal(mock_kernel.proof.proof_data.begin(),
+                           mock_kernel.proof.proof_data.begin() + static_cast<std::ptrdiff_t>(public_inputs_size),
+                           real_kernel.proof.proof_data.begin()));
+}
+
+TEST_F(mock_kernel_proof_tests, mock_verifier_accepts_only_untampered_mock_proofs)
+{
+    auto const mock_kernel = mock_previous_kernel(KernelCircuitPublicInputs<NT>{});
+    EXPECT_TRUE(verify_mock_kernel_proof(mock_kernel.vk, mock_kernel.proof));
+
+    auto tampered_public_input = mock_kernel.proof;
+    tampered_public_input.proof_data[sizeof(NT::fr) - 1] ^= 1;
+    EXPECT_FALSE(verify_mock_kernel_proof(mock_kernel.vk, tampered_public_input));
+
+    auto tampered_opening = mock_kernel.proof;
+    tampered_opening.proof_data.back() ^= 1;
+    EXPECT_FALSE(verify_mock_kernel_proof(mock_kernel.vk, tampered_opening));
+
+    NT::Proof const zero_proof{ .proof_data = std::vector<uint8_t>(mock_kernel.proof.proof_data.size(), 0) };
+    EXPECT_FALSE(verify_mock_kernel_proof(mock_kernel.vk, zero_proof));
+
+    // neither verifier accepts the other's proofs
+    auto const real_kernel = dummy_previous_kernel(true);
+    EXPECT_FALSE(verify_mock_kernel_proof(real_kernel.vk, real_kernel.proof));
+    EXPECT_FALSE(verify_kernel_proof(mock_kernel.vk, mock_kernel.proof));
+}
+
+TEST_F(mock_kernel_proof_tests, mock_kernel_proofs_are_bound_to_their_kernels_public_inputs)
+{
+    KernelCircuitPublicInputs<NT> public_inputs{};
+    public_inputs.end.new_commitments[0] = NT::fr(1);
+    auto const mock_kernel = mock_previous_kernel(public_inputs);
+    auto const other_mock_kernel = mock_previous_kernel(KernelCircuitPublicInputs<NT>{});
+    EXPECT_TRUE(verify_mock_kernel_proofs({ mock_kernel, other_mock_kernel }));
+
+    // a valid mock proof, but of other public inputs than the kernel's
+    auto swapped_proof = mock_kernel;
+    swapped_proof.proof = other_mock_kernel.proof;
+    EXPECT_TRUE(verify_mock_kernel_proof(swapped_proof.vk, swapped_proof.proof));
+    EXPECT_FALSE(verify_mock_kernel_proofs({ swapped_proof }));
+    EXPECT_FALSE(verify_mock_kernel_proofs({ other_mock_kernel, swapped_proof }));
+
+    auto tampered_public_inputs = mock_kernel;
+    tampered_public_inputs.public_inputs.end.new_commitments[0] = NT::fr(2);
+    EXPECT_FALSE(verify_mock_kernel_proofs({ tampered_public_inputs }));
+}
+
+TEST_F(mock_kernel_proof_tests, mock_proof_verifies_through_cbinds)
+{
+    uint8_t const* vk_buf = nullptr;
+    private_kernel__init_mock_verification_key(&vk_buf);
+
+    auto const mock_kernel = mock_previous_kernel(KernelCircuitPublicInputs<NT>{});
+    auto const& proof_data = mock_kernel.proof.proof_data;
+    EXPECT_EQ(private_kernel__verify_mock_proof(vk_buf, proof_data.data(), static_cast<uint32_t>(proof_data.size())),
+              1U);
+    EXPECT_EQ(private_kernel__verify_proof(vk_buf, proof_data.data(), static_cast<uint32_t>(proof_data.size())), 0U);
+
+    free((void*)vk_buf);
+}
+
+}  // namespace aztec3::circuits::kernel::private_kernel
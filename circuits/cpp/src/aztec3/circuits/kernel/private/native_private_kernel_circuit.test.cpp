@@ -1,4 +1,5 @@
 #include "c_bind.h"
+#include "contract_membership_cache.hpp"
 #include "testing_harness.hpp"
 
 #include "aztec3/circuits/apps/test_apps/basic_contract_deployment/basic_contract_deployment.hpp"
@@ -10,6 +11,7 @@
 #include <gtest/gtest.h>
 
 #include <cstdint>
+#include <vector>
 
 namespace {
 
@@ -21,6 +23,7 @@ using aztec3::circuits::kernel::private_kernel::testing_harness::do_private_call
 using aztec3::circuits::kernel::private_kernel::testing_harness::get_random_reads;
 using aztec3::circuits::kernel::private_kernel::testing_harness::validate_deployed_contract_address;
 using aztec3::circuits::kernel::private_kernel::testing_harness::validate_no_new_deployed_contract;
+using aztec3::utils::CircuitError;
 using aztec3::utils::CircuitErrorCode;
 
 }  // namespace
@@ -841,6 +844,22 @@ TEST_F(native_private_kernel_inner_tests, cbind_private_kernel__dummy_previous_k
     EXPECT_EQ(actual_ss.str(), expected_ss.str());
 }
 
+TEST_F(native_private_kernel_inner_tests, dummy_previous_kernel_is_built_once)
+{
+    auto first = utils::dummy_previous_kernel();
+    auto const second = utils::dummy_previous_kernel();
+
+    // later calls are copies of the first one, sharing its vk
+    EXPECT_EQ(first.vk, second.vk);
+    EXPECT_EQ(first.vk, utils::fake_vk());
+    EXPECT_EQ(first.public_inputs, second.public_inputs);
+    EXPECT_EQ(first.proof.proof_data, second.proof.proof_data);
+
+    // and modifying a copy leaves the cached one alone
+    first.public_inputs.is_private = !first.public_inputs.is_private;
+    EXPECT_NE(utils::dummy_previous_kernel().public_inputs.is_private, first.public_inputs.is_private);
+}
+
 TEST_F(native_private_kernel_inner_tests, native_read_request_bad_request)
 {
     NT::fr const& amount = 5;
@@ -1102,4 +1121,98 @@ TEST_F(native_private_kernel_inner_tests, native_max_read_requests_works)
     ASSERT_FALSE(composer.failed());
 }
 
+TEST_F(native_private_kernel_inner_tests, contract_membership_cache_skips_repeated_membership_checks)
+{
+    NT::fr const& amount = 5;
+    NT::fr const& asset_id = 1;
+    NT::fr const& memo = 999;
+
+    auto private_inputs = do_private_call_get_kernel_inputs_inner(false, deposit, { amount, asset_id, memo });
+
+    clear_contract_membership_cache();
+    set_contract_membership_cache_enabled(true);
+
+    DummyComposer uncached_composer = DummyComposer("private_kernel_tests__contract_membership_cache_miss");
+    auto const& uncached_public_inputs = native_private_kernel_circuit_inner(uncached_composer, private_inputs);
+    ASSERT_FALSE(uncached_composer.failed());
+
+    // The same call again is served from the cache and gives the same output
+    DummyComposer cached_composer = DummyComposer("private_kernel_tests__contract_membership_cache_hit");
+    auto const& cached_public_inputs = native_private_kernel_circuit_inner(cached_composer, private_inputs);
+    ASSERT_FALSE(cached_composer.failed());
+    EXPECT_EQ(cached_public_inputs, uncached_public_inputs);
+
+    auto const stats = get_contract_membership_cache_stats();
+    EXPECT_EQ(stats.misses, 1U);
+    EXPECT_EQ(stats.hits, 1U);
+
+    // A different historic contract tree root is not covered by the cached membership
+    auto wrong_root_inputs = private_inputs;
+    auto const wrong_root = NT::fr::random_element();
+    wrong_root_inputs.private_call.call_stack_item.public_inputs.historic_contract_tree_root = wrong_root;
+    wrong_root_inputs.previous_kernel.public_inputs.constants.historic_tree_roots.private_historic_tree_roots
+        .contract_tree_root = wrong_root;
+    DummyComposer wrong_root_composer = DummyComposer("private_kernel_tests__contract_membership_cache_wrong_root");
+    native_private_kernel_circuit_inner(wrong_root_composer, wrong_root_inputs);
+    EXPECT_TRUE(wrong_root_composer.failed());
+    EXPECT_EQ(wrong_root_composer.get_first_failure().code,
+              CircuitErrorCode::PRIVATE_KERNEL__COMPUTED_CONTRACT_TREE_ROOT_AND_PURPORTED_CONTRACT_TREE_ROOT_MISMATCH);
+
+    // the cache is opt-in, leave it off for the other tests
+    set_contract_membership_cache_enabled(false);
+    clear_contract_membership_cache();
+}
+
+TEST_F(native_private_kernel_inner_tests, native_sim_batch_cbind_matches_sequential_simulation)
+{
+    NT::fr const arg0 = 5;
+    NT::fr const arg1 = 1;
+    NT::fr const arg2 = 999;
+
+    // one valid transaction, and one whose contract address is zero
+    std::vector<PrivateKernelInputsInner<NT>> batch_inputs;
+    batch_inputs.push_back(do_private_call_get_kernel_inputs_inner(false, deposit, { arg0, arg1, arg2 }));
+    auto failing_inputs = do_private_call_get_kernel_inputs_inner(false, deposit, { arg0, arg1, arg2 });
+    failing_inputs.private_call.call_stack_item.public_inputs.call_context.storage_contract_address = 0;
+    failing_inputs.private_call.call_stack_item.contract_address = 0;
+    failing_inputs.previous_kernel.public_inputs.end.private_call_stack[0] =
+        failing_inputs.private_call.call_stack_item.hash();
+    batch_inputs.push_back(failing_inputs);
+
+    using serialize::read;
+    using serialize::write;
+
+    std::vector<uint8_t> batch_inputs_vec;
+    write(batch_inputs_vec, batch_inputs);
+    uint8_t const* public_inputs_buf = nullptr;
+    size_t public_inputs_size = 0;
+    uint8_t* const errors_buf =
+        private_kernel__sim_inner_batch(batch_inputs_vec.data(), &public_inputs_size, &public_inputs_buf);
+
+    std::vector<KernelCircuitPublicInputs<NT>> public_inputs;
+    uint8_t const* public_inputs_it = public_inputs_buf;
+    read(public_inputs_it, public_inputs);
+    EXPECT_EQ(static_cast<size_t>(public_inputs_it - public_inputs_buf), public_inputs_size);
+    std::vector<CircuitError> errors;
+    uint8_t const* errors_it = errors_buf;
+    read(errors_it, errors);
+    ASSERT_EQ(public_inputs.size(), batch_inputs.size());
+    ASSERT_EQ(errors.size(), batch_inputs.size());
+
+    for (size_t i = 0; i < batch_inputs.size(); i++) {
+        DummyComposer composer =
+            DummyComposer("private_kernel_tests__native_sim_batch_cbind_matches_sequential_simulation");
+        auto const expected_public_inputs = native_private_kernel_circuit_inner(composer, batch_inputs[i]);
+
+        EXPECT_EQ(composer.failed(), i == 1);
+        EXPECT_EQ(public_inputs[i], expected_public_inputs);
+        EXPECT_EQ(errors[i].code, composer.get_first_failure().code);
+        EXPECT_EQ(errors[i].message, composer.get_first_failure().message);
+    }
+    EXPECT_EQ(errors[1].code, CircuitErrorCode::PRIVATE_KERNEL__INVALID_CONTRACT_ADDRESS);
+
+    free((void*)public_inputs_buf);
+    free((void*)errors_buf);
+}
+
 }  // namespace aztec3::circuits::kernel::private_kernel
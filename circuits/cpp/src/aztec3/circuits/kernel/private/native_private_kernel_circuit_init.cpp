@@ -163,6 +163,10 @@ KernelCircuitPublicInputs<NT> native_private_kernel_circuit_initial(DummyCompose
 
     validate_this_private_call_against_tx_request(composer, private_inputs);
 
+    if (composer.should_stop()) {
+        return public_inputs;
+    }
+
     // TODO(rahul) FIXME - https://github.com/AztecProtocol/aztec-packages/issues/499
     // Noir doesn't have hash index so it can't hash private call stack item correctly
     // TODO(dbanks12): may need to comment out hash check in here according to TODO above
@@ -176,10 +180,18 @@ KernelCircuitPublicInputs<NT> native_private_kernel_circuit_initial(DummyCompose
         private_inputs.private_call.read_request_membership_witnesses,
         public_inputs.constants.historic_tree_roots.private_historic_tree_roots.private_data_tree_root);
 
+    if (composer.should_stop()) {
+        return public_inputs;
+    }
+
     // TODO(dbanks12): feels like update_end_values should happen after contract logic
     update_end_values(composer, private_inputs, public_inputs);
     common_update_end_values(composer, private_inputs.private_call, public_inputs);
 
+    if (composer.should_stop()) {
+        return public_inputs;
+    }
+
     common_contract_logic(composer,
                           private_inputs.private_call,
                           public_inputs,
@@ -135,6 +135,10 @@ KernelCircuitPublicInputs<NT> native_private_kernel_circuit_inner(DummyComposer&
 
     validate_inputs(composer, private_inputs);
 
+    if (composer.should_stop()) {
+        return public_inputs;
+    }
+
     // TODO(jeanmon) Resuscitate after issue 499 is fixed as explained below.
     // validate_this_private_call_hash(composer, private_inputs, public_inputs);
 
@@ -149,6 +153,9 @@ KernelCircuitPublicInputs<NT> native_private_kernel_circuit_inner(DummyComposer&
         private_inputs.private_call.read_request_membership_witnesses,
         public_inputs.constants.historic_tree_roots.private_historic_tree_roots.private_data_tree_root);
 
+    if (composer.should_stop()) {
+        return public_inputs;
+    }
 
     // TODO(dbanks12): feels like update_end_values should happen later
     common_update_end_values(composer, private_inputs.private_call, public_inputs);
@@ -156,6 +163,10 @@ KernelCircuitPublicInputs<NT> native_private_kernel_circuit_inner(DummyComposer&
     // ensure that historic/purported contract tree root matches the one in previous kernel
     validate_contract_tree_root(composer, private_inputs);
 
+    if (composer.should_stop()) {
+        return public_inputs;
+    }
+
     const auto private_call_stack_item = private_inputs.private_call.call_stack_item;
     common_contract_logic(composer,
                           private_inputs.private_call,
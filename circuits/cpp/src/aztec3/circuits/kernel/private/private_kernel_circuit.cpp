@@ -25,6 +25,8 @@ using aztec3::circuits::compute_contract_address;
 using aztec3::circuits::silo_commitment;
 using aztec3::circuits::silo_nullifier;
 
+using aztec3::circuits::recursion::ProofToAggregate;
+
 // TODO: NEED TO RECONCILE THE `proof`'s public inputs (which are uint8's) with the
 // private_call.call_stack_item.public_inputs!
 CT::AggregationObject verify_proofs(Composer& composer,
@@ -32,19 +34,13 @@ CT::AggregationObject verify_proofs(Composer& composer,
                                     size_t const& num_private_call_public_inputs,
                                     size_t const& num_private_kernel_public_inputs)
 {
-    // compute P0, P1 for private function proof
-    CT::AggregationObject aggregation_object = Aggregator::aggregate(
-        &composer, private_inputs.private_call.vk, private_inputs.private_call.proof, num_private_call_public_inputs);
-
-    // computes P0, P1 for previous kernel proof
-    // AND accumulates all of it in P0_agg, P1_agg
-    Aggregator::aggregate(&composer,
-                          private_inputs.previous_kernel.vk,
-                          private_inputs.previous_kernel.proof,
-                          num_private_kernel_public_inputs,
-                          aggregation_object);
-
-    return aggregation_object;
+    // computes P0, P1 for the private function proof and then the previous kernel proof,
+    // accumulating both into P0_agg, P1_agg
+    std::vector<ProofToAggregate<CT::VK>> const proofs = {
+        { private_inputs.private_call.vk, private_inputs.private_call.proof, num_private_call_public_inputs },
+        { private_inputs.previous_kernel.vk, private_inputs.previous_kernel.proof, num_private_kernel_public_inputs },
+    };
+    return Aggregator::aggregate_all(&composer, proofs);
 }
 
 /**
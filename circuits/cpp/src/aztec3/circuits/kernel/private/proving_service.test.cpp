@@ -0,0 +1,192 @@
+#include "init.hpp"
+
+#include "aztec3/circuits/abis/kernel_circuit_public_inputs.hpp"
+#include "aztec3/circuits/mock/mock_kernel_circuit.hpp"
+#include "aztec3/circuits/proving_service.hpp"
+
+#include <barretenberg/barretenberg.hpp>
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#ifndef NO_MULTITHREADING
+
+namespace {
+
+using aztec3::circuits::ProvingJobId;
+using aztec3::circuits::ProvingJobStatus;
+using aztec3::circuits::ProvingPriority;
+using aztec3::circuits::ProvingService;
+using aztec3::circuits::abis::KernelCircuitPublicInputs;
+using aztec3::circuits::mock::mock_kernel_circuit;
+
+constexpr size_t MB = 1 << 20;
+
+}  // namespace
+
+namespace aztec3::circuits::kernel::private_kernel {
+
+namespace {
+
+/**
+ * @brief Proves the mock kernel circuit, as a stand-in for a kernel proof
+ */
+NT::Proof prove_mock_kernel()
+{
+    Composer composer = Composer(aztec3::utils::get_crs_factory());
+    mock_kernel_circuit(composer, KernelCircuitPublicInputs<NT>{});
+    auto prover = composer.create_prover();
+    return prover.construct_proof();
+}
+
+}  // namespace
+
+class proving_service_tests : public ::testing::Test {
+  protected:
+    static void SetUpTestSuite()
+    {
+        barretenberg::srs::init_crs_factory("../barretenberg/cpp/srs_db/ignition");
+    }
+};
+
+TEST_F(proving_service_tests, proves_submitted_jobs)
+{
+    Composer verifier_composer = Composer(barretenberg::srs::get_crs_factory());
+    mock_kernel_circuit(verifier_composer, KernelCircuitPublicInputs<NT>{});
+    auto verifier = verifier_composer.create_verifier();
+
+    ProvingService service(2, 4 * MB);
+    std::vector<ProvingJobId> ids;
+    for (size_t i = 0; i < 4; i++) {
+        ids.push_back(service.submit(prove_mock_kernel, MB, ProvingPriority::BATCH));
+    }
+    for (auto const id : ids) {
+        auto const proof = service.wait(id);
+        ASSERT_TRUE(proof.has_value());
+        EXPECT_TRUE(verifier.verify_proof(*proof));
+        EXPECT_EQ(service.status(id), ProvingJobStatus::UNKNOWN);
+    }
+}
+
+TEST_F(proving_service_tests, memory_budget_caps_concurrency)
+{
+    std::atomic<size_t> running = 0;
+    std::atomic<size_t> max_running = 0;
+    auto prove = [&]() {
+        size_t const now_running = ++running;
+        size_t seen = max_running;
+        while (now_running > seen && !max_running.compare_exchange_weak(seen, now_running)) {
+        }
+        auto proof = prove_mock_kernel();
+        --running;
+        return proof;
+    };
+
+    // four workers, but room for only two jobs at a time
+    ProvingService service(4, 2 * MB);
+    std::vector<ProvingJobId> ids;
+    for (size_t i = 0; i < 6; i++) {
+        ids.push_back(service.submit(prove, MB, ProvingPriority::BATCH));
+    }
+    for (auto const id : ids) {
+        EXPECT_TRUE(service.wait(id).has_value());
+    }
+    EXPECT_LE(max_running.load(), 2U);
+    EXPECT_GE(max_running.load(), 1U);
+}
+
+TEST_F(proving_service_tests, latency_critical_jobs_overtake_queued_batch_jobs)
+{
+    std::promise<void> release;
+    auto released = release.get_future().share();
+    std::mutex order_mutex;
+    std::vector<char> start_order;
+    auto job = [&](char name) {
+        return [&, name]() {
+            {
+                std::lock_guard<std::mutex> const lock(order_mutex);
+                start_order.push_back(name);
+            }
+            if (name == 'a') {
+                released.wait();
+            }
+            return prove_mock_kernel();
+        };
+    };
+
+    // one worker, held up by `a` until both others are queued
+    ProvingService service(1, 4 * MB);
+    auto const a = service.submit(job('a'), MB, ProvingPriority::BATCH);
+    while (service.status(a) != ProvingJobStatus::RUNNING) {
+        std::this_thread::yield();
+    }
+    auto const b = service.submit(job('b'), MB, ProvingPriority::BATCH);
+    auto const c = service.submit(job('c'), MB, ProvingPriority::LATENCY_CRITICAL);
+    release.set_value();
+
+    EXPECT_TRUE(service.wait(a).has_value());
+    EXPECT_TRUE(service.wait(b).has_value());
+    EXPECT_TRUE(service.wait(c).has_value());
+    EXPECT_EQ(start_order, (std::vector<char>{ 'a', 'c', 'b' }));
+}
+
+TEST_F(proving_service_tests, queued_jobs_can_be_cancelled)
+{
+    std::promise<void> release;
+    auto released = release.get_future().share();
+
+    ProvingService service(1, 4 * MB);
+    auto const running = service.submit(
+        [&]() {
+            released.wait();
+            return prove_mock_kernel();
+        },
+        MB,
+        ProvingPriority::BATCH);
+    while (service.status(running) != ProvingJobStatus::RUNNING) {
+        std::this_thread::yield();
+    }
+    auto const queued = service.submit(prove_mock_kernel, MB, ProvingPriority::BATCH);
+
+    EXPECT_FALSE(service.cancel(running));
+    EXPECT_TRUE(service.cancel(queued));
+    EXPECT_EQ(service.status(queued), ProvingJobStatus::CANCELLED);
+    EXPECT_FALSE(service.wait(queued).has_value());
+
+    release.set_value();
+    EXPECT_TRUE(service.wait(running).has_value());
+}
+
+TEST_F(proving_service_tests, throwing_job_fails)
+{
+    ProvingService service(1, 4 * MB);
+    auto const id = service.submit(
+        []() -> NT::Proof { throw std::runtime_error("proving failed"); }, MB, ProvingPriority::BATCH);
+    EXPECT_FALSE(service.wait(id).has_value());
+}
+
+TEST_F(proving_service_tests, uncollected_jobs_expire)
+{
+    // finished jobs are forgotten by the next submit
+    ProvingService service(1, 4 * MB, std::chrono::milliseconds(0));
+    auto const uncollected = service.submit(prove_mock_kernel, MB, ProvingPriority::BATCH);
+    while (service.status(uncollected) != ProvingJobStatus::DONE) {
+        std::this_thread::yield();
+    }
+
+    auto const collected = service.submit(prove_mock_kernel, MB, ProvingPriority::BATCH);
+    EXPECT_EQ(service.status(uncollected), ProvingJobStatus::UNKNOWN);
+    EXPECT_FALSE(service.wait(uncollected).has_value());
+    EXPECT_TRUE(service.wait(collected).has_value());
+}
+
+}  // namespace aztec3::circuits::kernel::private_kernel
+
+#endif
@@ -2,6 +2,7 @@
 #include "init.hpp"
 
 #include "aztec3/circuits/mock/mock_kernel_circuit.hpp"
+#include "aztec3/utils/crs_factory.hpp"
 
 #include <barretenberg/barretenberg.hpp>
 
@@ -15,39 +16,26 @@ using aztec3::circuits::mock::mock_kernel_circuit;
 
 namespace aztec3::circuits::kernel::private_kernel::utils {
 
-/**
- * @brief Create a fake verification key
- *
- * @details will not work with real circuits
- *
- * @return std::shared_ptr<NT::VK> fake verification key
- */
-std::shared_ptr<NT::VK> fake_vk()
+namespace {
+
+std::shared_ptr<NT::VK> build_fake_vk()
 {
     std::map<std::string, NT::bn254_point> commitments;
-    commitments["FAKE"] = *new NT::bn254_point(NT::fq(0), NT::fq(0));
+    commitments["FAKE"] = NT::bn254_point(NT::fq(0), NT::fq(0));
     NT::VKData vk_data = { .composer_type = proof_system::ComposerType::TURBO,
                            .circuit_size = 2048,
                            .num_public_inputs = 116,
                            .commitments = commitments,
                            .contains_recursive_proof = false,
                            .recursive_proof_public_input_indices = {} };
-    return std::make_shared<NT::VK>(std::move(vk_data), barretenberg::srs::get_crs_factory()->get_verifier_crs());
+    return std::make_shared<NT::VK>(std::move(vk_data), aztec3::utils::get_crs_factory()->get_verifier_crs());
 }
 
-/**
- * @brief Create a dummy "previous kernel"
- *
- * @details For use in the first iteration of the  kernel circuit
- *
- * @param real_vk_proof should the vk and proof included be real and usable by real circuits?
- * @return PreviousKernelData<NT> the previous kernel data for use in the kernel circuit
- */
-PreviousKernelData<NT> dummy_previous_kernel(bool real_vk_proof = false)
+PreviousKernelData<NT> build_dummy_previous_kernel(bool real_vk_proof)
 {
     PreviousKernelData<NT> const init_previous_kernel{};
 
-    auto crs_factory = barretenberg::srs::get_crs_factory();
+    auto crs_factory = aztec3::utils::get_crs_factory();
     Composer mock_kernel_composer = Composer(crs_factory);
     auto mock_kernel_public_inputs = mock_kernel_circuit(mock_kernel_composer, init_previous_kernel.public_inputs);
 
@@ -71,4 +59,42 @@ PreviousKernelData<NT> dummy_previous_kernel(bool real_vk_proof = false)
     return previous_kernel;
 }
 
+}  // namespace
+
+/**
+ * @brief Create a fake verification key
+ *
+ * @details will not work with real circuits. Built once per process: every caller shares the same key, which must
+ * be treated as read-only. The key holds the verifier CRS of the factory `get_crs_factory` returned at the first call,
+ * so initialise the CRS (`init_crs_factory` or `init_mmap_crs_factory`) before calling this, and don't swap it after.
+ *
+ * @return std::shared_ptr<NT::VK> fake verification key
+ */
+std::shared_ptr<NT::VK> fake_vk()
+{
+    static std::shared_ptr<NT::VK> const vk = build_fake_vk();
+    return vk;
+}
+
+/**
+ * @brief Create a dummy "previous kernel"
+ *
+ * @details For use in the first iteration of the  kernel circuit. Building it means building (and, for a real one,
+ * proving) the mock kernel circuit, so each variant is built once per process and copied out afterwards. The copies
+ * share the (read-only) vk, and every variant is bound to the CRS of its first call, as `fake_vk` is.
+ *
+ * @param real_vk_proof should the vk and proof included be real and usable by real circuits?
+ * @return PreviousKernelData<NT> the previous kernel data for use in the kernel circuit
+ */
+PreviousKernelData<NT> dummy_previous_kernel(bool real_vk_proof = false)
+{
+    // function-local statics are initialised exactly once, even when first reached from several threads
+    if (real_vk_proof) {
+        static PreviousKernelData<NT> const real_previous_kernel = build_dummy_previous_kernel(true);
+        return real_previous_kernel;
+    }
+    static PreviousKernelData<NT> const mock_previous_kernel = build_dummy_previous_kernel(false);
+    return mock_previous_kernel;
+}
+
 }  // namespace aztec3::circuits::kernel::private_kernel::utils
\ No newline at end of file
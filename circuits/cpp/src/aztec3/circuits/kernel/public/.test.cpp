@@ -1,6 +1,8 @@
+#include "c_bind.h"
 #include "init.hpp"
 #include "native_public_kernel_circuit_no_previous_kernel.hpp"
 #include "native_public_kernel_circuit_private_previous_kernel.hpp"
+#include "native_public_kernel_circuit_public_call_stack.hpp"
 #include "native_public_kernel_circuit_public_previous_kernel.hpp"
 
 #include "aztec3/circuits/abis/call_context.hpp"
@@ -23,8 +25,10 @@
 #include "aztec3/circuits/abis/types.hpp"
 #include "aztec3/circuits/apps/function_execution_context.hpp"
 #include "aztec3/circuits/hash.hpp"
+#include "aztec3/circuits/kernel/private/utils.hpp"
 #include "aztec3/constants.hpp"
 #include "aztec3/utils/array.hpp"
+#include "aztec3/utils/batch_simulation.hpp"
 #include "aztec3/utils/circuit_errors.hpp"
 
 #include <gtest/gtest.h>
@@ -50,6 +54,7 @@ using aztec3::circuits::abis::SignedTxRequest;
 using aztec3::circuits::abis::TxContext;
 using aztec3::circuits::abis::TxRequest;
 using aztec3::circuits::abis::public_kernel::PublicCallData;
+using aztec3::utils::simulate_batch;
 using aztec3::utils::source_arrays_are_in_target;
 using aztec3::utils::zero_array;
 }  // namespace
@@ -1269,4 +1274,154 @@ TEST(public_kernel_tests, public_kernel_fails_creating_new_nullifiers_on_static_
               CircuitErrorCode::PUBLIC_KERNEL__NEW_NULLIFIERS_PROHIBITED_IN_STATIC_CALL);
 }
 
+TEST(public_kernel_tests, public_call_stack_matches_chained_single_iterations)
+{
+    DummyComposer dummyComposer =
+        DummyComposer("public_kernel_tests__public_call_stack_matches_chained_single_iterations");
+    PublicKernelInputs<NT> inputs = get_kernel_inputs_with_previous_kernel(true);
+
+    // leave room in the accumulated data for the side effects of both calls
+    inputs.previous_kernel.public_inputs.end.new_commitments = zero_array<NT::fr, KERNEL_NEW_COMMITMENTS_LENGTH>();
+    inputs.previous_kernel.public_inputs.end.new_nullifiers = zero_array<NT::fr, KERNEL_NEW_NULLIFIERS_LENGTH>();
+    inputs.previous_kernel.public_inputs.end.new_l2_to_l1_msgs = zero_array<NT::fr, KERNEL_NEW_L2_TO_L1_MSGS_LENGTH>();
+
+    // drop the nested calls so that the two calls below are the only items ever on the stack
+    auto& first_call = inputs.public_call;
+    first_call.call_stack_item.public_inputs.public_call_stack = zero_array<NT::fr, PUBLIC_CALL_STACK_LENGTH>();
+    auto second_call = first_call;
+    second_call.call_stack_item.public_inputs.args_hash += 1;
+
+    // the second call is on top of the stack so it is executed first
+    auto& previous_public_call_stack = inputs.previous_kernel.public_inputs.end.public_call_stack;
+    previous_public_call_stack = zero_array<NT::fr, KERNEL_PUBLIC_CALL_STACK_LENGTH>();
+    previous_public_call_stack[0] = get_call_stack_item_hash(first_call.call_stack_item);
+    previous_public_call_stack[1] = get_call_stack_item_hash(second_call.call_stack_item);
+    std::vector<PublicCallData<NT>> const public_calls = { second_call, first_call };
+
+    auto const public_inputs =
+        native_public_kernel_circuit_public_call_stack(dummyComposer, inputs.previous_kernel, public_calls);
+    ASSERT_FALSE(dummyComposer.failed());
+
+    // run the same two iterations one by one
+    DummyComposer sequentialComposer =
+        DummyComposer("public_kernel_tests__public_call_stack_matches_chained_single_iterations__sequential");
+    PublicKernelInputs<NT> sequential_inputs = inputs;
+    sequential_inputs.public_call = second_call;
+    sequential_inputs.previous_kernel.public_inputs =
+        native_public_kernel_circuit_private_previous_kernel(sequentialComposer, sequential_inputs);
+    sequential_inputs.public_call = first_call;
+    auto const expected_public_inputs =
+        native_public_kernel_circuit_public_previous_kernel(sequentialComposer, sequential_inputs);
+    ASSERT_FALSE(sequentialComposer.failed());
+
+    ASSERT_EQ(public_inputs, expected_public_inputs);
+    ASSERT_EQ(array_length(public_inputs.end.public_call_stack), 0U);
+}
+
+TEST(public_kernel_tests, public_call_stack_stops_at_first_failure)
+{
+    DummyComposer dummyComposer = DummyComposer("public_kernel_tests__public_call_stack_stops_at_first_failure");
+    PublicKernelInputs<NT> const inputs = get_kernel_inputs_with_previous_kernel(true);
+
+    // after the first iteration the nested calls are on top of the stack, so repeating the call must fail
+    std::vector<PublicCallData<NT>> const public_calls = { inputs.public_call, inputs.public_call };
+
+    native_public_kernel_circuit_public_call_stack(dummyComposer, inputs.previous_kernel, public_calls);
+    ASSERT_TRUE(dummyComposer.failed());
+    ASSERT_EQ(dummyComposer.get_first_failure().code,
+              CircuitErrorCode::PUBLIC_KERNEL__CALCULATED_PRIVATE_CALL_HASH_AND_PROVIDED_PRIVATE_CALL_HASH_MISMATCH);
+}
+
+TEST(public_kernel_tests, batch_simulation_matches_sequential_simulation)
+{
+    constexpr size_t BATCH_SIZE = 8;
+    std::vector<PublicKernelInputs<NT>> batch_inputs;
+    for (size_t i = 0; i < BATCH_SIZE; i++) {
+        PublicKernelInputs<NT> inputs = get_kernel_inputs_with_previous_kernel(i % 2 == 0);
+
+        // give every item its own call and make every third one fail
+        inputs.public_call.call_stack_item.public_inputs.args_hash += NT::fr(i);
+        inputs.public_call.call_stack_item.public_inputs.call_context.is_delegate_call = i % 3 == 0;
+        inputs.previous_kernel.public_inputs.end.public_call_stack[0] =
+            get_call_stack_item_hash(inputs.public_call.call_stack_item);
+
+        batch_inputs.emplace_back(inputs);
+    }
+
+    auto sim_public_kernel = [](DummyComposer& composer, PublicKernelInputs<NT> const& inputs) {
+        return inputs.previous_kernel.public_inputs.is_private
+                   ? native_public_kernel_circuit_private_previous_kernel(composer, inputs)
+                   : native_public_kernel_circuit_public_previous_kernel(composer, inputs);
+    };
+
+    auto const batch_result =
+        simulate_batch("public_kernel_tests__batch_simulation_matches_sequential_simulation__batch",
+                       batch_inputs,
+                       sim_public_kernel);
+    ASSERT_EQ(batch_result.outputs.size(), BATCH_SIZE);
+    ASSERT_EQ(batch_result.errors.size(), BATCH_SIZE);
+
+    for (size_t i = 0; i < BATCH_SIZE; i++) {
+        DummyComposer dummyComposer =
+            DummyComposer("public_kernel_tests__batch_simulation_matches_sequential_simulation__sequential");
+        auto const expected_public_inputs = sim_public_kernel(dummyComposer, batch_inputs[i]);
+
+        ASSERT_EQ(dummyComposer.failed(), i % 3 == 0);
+        ASSERT_EQ(batch_result.outputs[i], expected_public_inputs);
+        ASSERT_EQ(batch_result.errors[i].code, dummyComposer.get_first_failure().code);
+        ASSERT_EQ(batch_result.errors[i].message, dummyComposer.get_first_failure().message);
+    }
+}
+
+TEST(public_kernel_tests, sparse_cbind_matches_simulation)
+{
+    // the previous kernel's vk is serialized with it
+    barretenberg::srs::init_crs_factory("../barretenberg/cpp/srs_db/ignition");
+
+    for (bool const fails : { false, true }) {
+        for (bool const private_previous : { true, false }) {
+            PublicKernelInputs<NT> inputs = get_kernel_inputs_with_previous_kernel(private_previous);
+            inputs.previous_kernel.vk = private_kernel::utils::fake_vk();
+            inputs.public_call.call_stack_item.public_inputs.call_context.is_delegate_call = fails;
+            inputs.previous_kernel.public_inputs.end.public_call_stack[0] =
+                get_call_stack_item_hash(inputs.public_call.call_stack_item);
+
+            std::vector<uint8_t> inputs_vec;
+            write(inputs_vec, inputs);
+            std::vector<uint8_t> sparse_inputs_vec;
+            write_sparse(sparse_inputs_vec, inputs);
+            EXPECT_LT(sparse_inputs_vec.size(), inputs_vec.size());
+
+            uint8_t const* public_inputs_buf = nullptr;
+            size_t public_inputs_size = 0;
+            uint8_t* const circuit_failure_ptr =
+                public_kernel__sim_sparse(sparse_inputs_vec.data(), &public_inputs_size, &public_inputs_buf);
+
+            DummyComposer dummyComposer = DummyComposer("public_kernel_tests__sparse_cbind_matches_simulation");
+            auto const expected_public_inputs =
+                private_previous ? native_public_kernel_circuit_private_previous_kernel(dummyComposer, inputs)
+                                 : native_public_kernel_circuit_public_previous_kernel(dummyComposer, inputs);
+            ASSERT_EQ(dummyComposer.failed(), fails);
+
+            KernelCircuitPublicInputs<NT> public_inputs;
+            uint8_t const* public_inputs_it = public_inputs_buf;
+            read_sparse(public_inputs_it, public_inputs);
+            EXPECT_EQ(static_cast<size_t>(public_inputs_it - public_inputs_buf), public_inputs_size);
+            EXPECT_EQ(public_inputs, expected_public_inputs);
+
+            ASSERT_EQ(circuit_failure_ptr != nullptr, fails);
+            if (circuit_failure_ptr != nullptr) {
+                aztec3::utils::CircuitError failure;
+                uint8_t const* failure_it = circuit_failure_ptr;
+                read(failure_it, failure);
+                EXPECT_EQ(failure.code, dummyComposer.get_first_failure().code);
+                EXPECT_EQ(failure.message, dummyComposer.get_first_failure().message);
+            }
+
+            free((void*)public_inputs_buf);
+            free((void*)circuit_failure_ptr);
+        }
+    }
+}
+
 }  // namespace aztec3::circuits::kernel::public_kernel
\ No newline at end of file
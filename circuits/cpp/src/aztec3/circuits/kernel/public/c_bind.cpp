@@ -7,7 +7,11 @@
 #include "aztec3/circuits/abis/public_kernel/public_kernel_inputs.hpp"
 #include "aztec3/circuits/abis/public_kernel/public_kernel_inputs_no_previous_kernel.hpp"
 #include "aztec3/constants.hpp"
+#include "aztec3/utils/batch_simulation.hpp"
 #include "aztec3/utils/dummy_composer.hpp"
+#include "aztec3/utils/input_slot.hpp"
+#include "aztec3/utils/malloc_output.hpp"
+#include "aztec3/utils/scratch_arena.hpp"
 #include "aztec3/utils/types/native_types.hpp"
 
 #include <barretenberg/barretenberg.hpp>
@@ -17,11 +21,49 @@ using Composer = plonk::UltraPlonkComposer;
 using NT = aztec3::utils::types::NativeTypes;
 using DummyComposer = aztec3::utils::DummyComposer;
 using aztec3::circuits::abis::KernelCircuitPublicInputs;
+using aztec3::circuits::abis::PreviousKernelData;
+using aztec3::circuits::abis::public_kernel::PublicCallData;
 using aztec3::circuits::abis::public_kernel::PublicKernelInputs;
 using aztec3::circuits::abis::public_kernel::PublicKernelInputsNoPreviousKernel;
 using aztec3::circuits::kernel::public_kernel::native_public_kernel_circuit_no_previous_kernel;
 using aztec3::circuits::kernel::public_kernel::native_public_kernel_circuit_private_previous_kernel;
+using aztec3::circuits::kernel::public_kernel::native_public_kernel_circuit_public_call_stack;
 using aztec3::circuits::kernel::public_kernel::native_public_kernel_circuit_public_previous_kernel;
+using aztec3::utils::get_input_slot;
+using aztec3::utils::OutputEncoding;
+using aztec3::utils::serialize_to_malloc_buffer;
+using aztec3::utils::serialize_to_scratch_arena;
+using aztec3::utils::simulate_batch;
+
+/**
+ * @brief Simulates the public kernel on `composer`, with the circuit variant for the previous kernel's kind
+ */
+KernelCircuitPublicInputs<NT> sim_public_kernel(DummyComposer& composer, PublicKernelInputs<NT> const& inputs)
+{
+    return inputs.previous_kernel.public_inputs.is_private
+               ? native_public_kernel_circuit_private_previous_kernel(composer, inputs)
+               : native_public_kernel_circuit_public_previous_kernel(composer, inputs);
+}
+
+/**
+ * @brief Simulates the public kernel with no previous kernel on `composer`, returning what
+ * `public_kernel_no_previous_kernel__sim` returns
+ */
+uint8_t* sim_public_kernel_no_previous_kernel(DummyComposer& composer,
+                                              uint8_t const* public_kernel_inputs_buf,
+                                              size_t* public_kernel_public_inputs_size_out,
+                                              uint8_t const** public_kernel_public_inputs_buf)
+{
+    auto& public_kernel_inputs = get_input_slot<PublicKernelInputsNoPreviousKernel<NT>>();
+    read(public_kernel_inputs_buf, public_kernel_inputs);
+
+    KernelCircuitPublicInputs<NT> const public_inputs =
+        native_public_kernel_circuit_no_previous_kernel(composer, public_kernel_inputs);
+
+    return serialize_to_malloc_buffer(
+        composer, public_inputs, public_kernel_public_inputs_size_out, public_kernel_public_inputs_buf);
+}
+
 }  // namespace
 
 // WASM Cbinds
@@ -52,32 +94,109 @@ WASM_EXPORT size_t public_kernel__init_verification_key(uint8_t const* pk_buf, u
 
 CBIND(public_kernel__sim, [](PublicKernelInputs<NT> public_kernel_inputs) {
     DummyComposer composer = DummyComposer("public_kernel__sim");
-    KernelCircuitPublicInputs<NT> const result =
-        public_kernel_inputs.previous_kernel.public_inputs.is_private
-            ? native_public_kernel_circuit_private_previous_kernel(composer, public_kernel_inputs)
-            : native_public_kernel_circuit_public_previous_kernel(composer, public_kernel_inputs);
-    return composer.result_or_error(result);
+    return composer.result_or_error(sim_public_kernel(composer, public_kernel_inputs));
+});
+
+/**
+ * @brief As `public_kernel__sim`, but in fail-fast mode (see `DummyComposer::should_stop`): the circuit stops at the
+ * first failure, which is the one returned
+ */
+CBIND(public_kernel__sim_fail_fast, [](PublicKernelInputs<NT> public_kernel_inputs) {
+    DummyComposer composer = DummyComposer("public_kernel__sim_fail_fast", true);
+    return composer.result_or_error(sim_public_kernel(composer, public_kernel_inputs));
 });
 
+/**
+ * @brief As `public_kernel__sim`, but through raw buffers, with both the previous kernel's public inputs and the
+ * returned public inputs in the sparse encoding of `write_sparse` (see `public_kernel_no_previous_kernel__sim_sparse`)
+ */
+WASM_EXPORT uint8_t* public_kernel__sim_sparse(uint8_t const* public_kernel_inputs_buf,
+                                               size_t* public_kernel_public_inputs_size_out,
+                                               uint8_t const** public_kernel_public_inputs_buf)
+{
+    DummyComposer composer = DummyComposer("public_kernel__sim_sparse");
+
+    auto& public_kernel_inputs = get_input_slot<PublicKernelInputs<NT>>();
+    read_sparse(public_kernel_inputs_buf, public_kernel_inputs);
+
+    KernelCircuitPublicInputs<NT> const public_inputs = sim_public_kernel(composer, public_kernel_inputs);
+
+    return serialize_to_malloc_buffer<OutputEncoding::SPARSE>(
+        composer, public_inputs, public_kernel_public_inputs_size_out, public_kernel_public_inputs_buf);
+}
+
+CBIND(public_kernel__sim_batch, [](std::vector<PublicKernelInputs<NT>> public_kernel_inputs) {
+    return simulate_batch("public_kernel__sim_batch", public_kernel_inputs, sim_public_kernel).to_circuit_results();
+});
+
+CBIND(public_kernel__sim_public_call_stack,
+      [](PreviousKernelData<NT> previous_kernel, std::vector<PublicCallData<NT>> public_calls) {
+          DummyComposer composer = DummyComposer("public_kernel__sim_public_call_stack");
+          KernelCircuitPublicInputs<NT> const result =
+              native_public_kernel_circuit_public_call_stack(composer, previous_kernel, public_calls);
+          return composer.result_or_error(result);
+      });
+
 WASM_EXPORT uint8_t* public_kernel_no_previous_kernel__sim(uint8_t const* public_kernel_inputs_buf,
                                                            size_t* public_kernel_public_inputs_size_out,
                                                            uint8_t const** public_kernel_public_inputs_buf)
 {
     DummyComposer composer = DummyComposer("public_kernel_no_previous_kernel__sim");
+    return sim_public_kernel_no_previous_kernel(
+        composer, public_kernel_inputs_buf, public_kernel_public_inputs_size_out, public_kernel_public_inputs_buf);
+}
+
+/**
+ * @brief As `public_kernel_no_previous_kernel__sim`, in fail-fast mode (see `public_kernel__sim_fail_fast`)
+ */
+WASM_EXPORT uint8_t* public_kernel_no_previous_kernel__sim_fail_fast(uint8_t const* public_kernel_inputs_buf,
+                                                                     size_t* public_kernel_public_inputs_size_out,
+                                                                     uint8_t const** public_kernel_public_inputs_buf)
+{
+    DummyComposer composer = DummyComposer("public_kernel_no_previous_kernel__sim_fail_fast", true);
+    return sim_public_kernel_no_previous_kernel(
+        composer, public_kernel_inputs_buf, public_kernel_public_inputs_size_out, public_kernel_public_inputs_buf);
+}
+
+/**
+ * @brief As `public_kernel_no_previous_kernel__sim`, but the public inputs are returned in the sparse encoding of
+ * `write_sparse`, which records runs of empty array items compactly
+ */
+WASM_EXPORT uint8_t* public_kernel_no_previous_kernel__sim_sparse(uint8_t const* public_kernel_inputs_buf,
+                                                                  size_t* public_kernel_public_inputs_size_out,
+                                                                  uint8_t const** public_kernel_public_inputs_buf)
+{
+    DummyComposer composer = DummyComposer("public_kernel_no_previous_kernel__sim_sparse");
+
+    auto& public_kernel_inputs = get_input_slot<PublicKernelInputsNoPreviousKernel<NT>>();
+    read(public_kernel_inputs_buf, public_kernel_inputs);
+
+    KernelCircuitPublicInputs<NT> const public_inputs =
+        native_public_kernel_circuit_no_previous_kernel(composer, public_kernel_inputs);
+
+    return serialize_to_malloc_buffer<OutputEncoding::SPARSE>(
+        composer, public_inputs, public_kernel_public_inputs_size_out, public_kernel_public_inputs_buf);
+}
+
+/**
+ * @brief As `public_kernel_no_previous_kernel__sim`, but the public inputs and the failure (if any) are serialized
+ * straight into the calling thread's scratch arena
+ * @details The returned pointers stay valid until the next `*_scratch` call on this thread or
+ * `scratch_arena__release`, and must not be freed.
+ */
+WASM_EXPORT uint8_t const* public_kernel_no_previous_kernel__sim_scratch(
+    uint8_t const* public_kernel_inputs_buf,
+    size_t* public_kernel_public_inputs_size_out,
+    uint8_t const** public_kernel_public_inputs_buf)
+{
+    DummyComposer composer = DummyComposer("public_kernel_no_previous_kernel__sim_scratch");
 
-    PublicKernelInputsNoPreviousKernel<NT> public_kernel_inputs;
+    auto& public_kernel_inputs = get_input_slot<PublicKernelInputsNoPreviousKernel<NT>>();
     read(public_kernel_inputs_buf, public_kernel_inputs);
 
     KernelCircuitPublicInputs<NT> const public_inputs =
         native_public_kernel_circuit_no_previous_kernel(composer, public_kernel_inputs);
 
-    // serialize public inputs to bytes vec
-    std::vector<uint8_t> public_inputs_vec;
-    write(public_inputs_vec, public_inputs);
-    // copy public inputs to output buffer
-    auto* raw_public_inputs_buf = (uint8_t*)malloc(public_inputs_vec.size());
-    memcpy(raw_public_inputs_buf, (void*)public_inputs_vec.data(), public_inputs_vec.size());
-    *public_kernel_public_inputs_buf = raw_public_inputs_buf;
-    *public_kernel_public_inputs_size_out = public_inputs_vec.size();
-    return composer.alloc_and_serialize_first_failure();
+    return serialize_to_scratch_arena(
+        composer, public_inputs, public_kernel_public_inputs_size_out, public_kernel_public_inputs_buf);
 }
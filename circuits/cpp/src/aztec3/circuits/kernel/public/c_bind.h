@@ -6,6 +6,22 @@
 WASM_EXPORT size_t public_kernel__init_proving_key(uint8_t const** pk_buf);
 WASM_EXPORT size_t public_kernel__init_verification_key(uint8_t const* pk_buf, uint8_t const** vk_buf);
 CBIND_DECL(public_kernel__sim);
+CBIND_DECL(public_kernel__sim_fail_fast);
+WASM_EXPORT uint8_t* public_kernel__sim_sparse(uint8_t const* public_kernel_inputs_buf,
+                                               size_t* public_kernel_public_inputs_size_out,
+                                               uint8_t const** public_kernel_public_inputs_buf);
+CBIND_DECL(public_kernel__sim_batch);
+CBIND_DECL(public_kernel__sim_public_call_stack);
 WASM_EXPORT uint8_t* public_kernel_no_previous_kernel__sim(uint8_t const* public_kernel_inputs_buf,
                                                            size_t* public_kernel_public_inputs_size_out,
-                                                           uint8_t const** public_kernel_public_inputs_buf);
\ No newline at end of file
+                                                           uint8_t const** public_kernel_public_inputs_buf);
+WASM_EXPORT uint8_t* public_kernel_no_previous_kernel__sim_fail_fast(uint8_t const* public_kernel_inputs_buf,
+                                                                     size_t* public_kernel_public_inputs_size_out,
+                                                                     uint8_t const** public_kernel_public_inputs_buf);
+WASM_EXPORT uint8_t* public_kernel_no_previous_kernel__sim_sparse(uint8_t const* public_kernel_inputs_buf,
+                                                                  size_t* public_kernel_public_inputs_size_out,
+                                                                  uint8_t const** public_kernel_public_inputs_buf);
+WASM_EXPORT uint8_t const* public_kernel_no_previous_kernel__sim_scratch(
+    uint8_t const* public_kernel_inputs_buf,
+    size_t* public_kernel_public_inputs_size_out,
+    uint8_t const** public_kernel_public_inputs_buf);
\ No newline at end of file
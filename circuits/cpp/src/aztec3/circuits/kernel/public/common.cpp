@@ -57,11 +57,13 @@ void validate_this_public_call_hash(DummyComposer& composer,
 
     composer.do_assert(
         popped_public_call_hash == calculated_this_public_call_hash,
-        format("calculated public_call_hash (",
-               calculated_this_public_call_hash,
-               ") does not match provided public_call_hash (",
-               popped_public_call_hash,
-               ") at the top of the call stack"),
+        [&]() {
+            return format("calculated public_call_hash (",
+                          calculated_this_public_call_hash,
+                          ") does not match provided public_call_hash (",
+                          popped_public_call_hash,
+                          ") at the top of the call stack");
+        },
         CircuitErrorCode::PUBLIC_KERNEL__CALCULATED_PRIVATE_CALL_HASH_AND_PROVIDED_PRIVATE_CALL_HASH_MISMATCH);
 };
 }  // namespace aztec3::circuits::kernel::public_kernel
\ No newline at end of file
@@ -10,6 +10,7 @@
 #include "aztec3/circuits/abis/public_kernel/public_kernel_inputs_no_previous_kernel.hpp"
 #include "aztec3/circuits/hash.hpp"
 #include "aztec3/utils/array.hpp"
+#include "aztec3/utils/bounded_array.hpp"
 #include "aztec3/utils/dummy_composer.hpp"
 
 using NT = aztec3::utils::types::NativeTypes;
@@ -28,6 +29,7 @@ using aztec3::circuits::root_from_sibling_path;
 using aztec3::utils::array_length;
 using aztec3::utils::array_pop;
 using aztec3::utils::array_push;
+using aztec3::utils::BoundedArray;
 using aztec3::utils::push_array_to_array;
 
 namespace aztec3::circuits::kernel::public_kernel {
@@ -71,56 +73,71 @@ void common_validate_call_stack(DummyComposer& composer, KernelInput const& publ
         const auto calculated_hash = preimage.hash();
         composer.do_assert(
             hash == calculated_hash,
-            format(
-                "public_call_stack[", i, "] = ", hash, "; does not reconcile with calculatedHash = ", calculated_hash),
+            [&]() {
+                return format("public_call_stack[",
+                              i,
+                              "] = ",
+                              hash,
+                              "; does not reconcile with calculatedHash = ",
+                              calculated_hash);
+            },
             CircuitErrorCode::PUBLIC_KERNEL__PUBLIC_CALL_STACK_MISMATCH);
 
         // here we validate the msg sender for each call on the stack
         // we need to consider regular vs delegate calls
         const auto preimage_msg_sender = preimage.public_inputs.call_context.msg_sender;
         const auto expected_msg_sender = is_delegate_call ? our_msg_sender : our_contract_address;
-        composer.do_assert(expected_msg_sender == preimage_msg_sender,
-                           format("call_stack_msg_sender[",
-                                  i,
-                                  "] = ",
-                                  preimage_msg_sender,
-                                  " expected ",
-                                  expected_msg_sender,
-                                  "; does not reconcile"),
-                           CircuitErrorCode::PUBLIC_KERNEL__PUBLIC_CALL_STACK_INVALID_MSG_SENDER);
+        composer.do_assert(
+            expected_msg_sender == preimage_msg_sender,
+            [&]() {
+                return format("call_stack_msg_sender[",
+                              i,
+                              "] = ",
+                              preimage_msg_sender,
+                              " expected ",
+                              expected_msg_sender,
+                              "; does not reconcile");
+            },
+            CircuitErrorCode::PUBLIC_KERNEL__PUBLIC_CALL_STACK_INVALID_MSG_SENDER);
 
         // here we validate the storage address for each call on the stack
         // we need to consider regular vs delegate calls
         const auto preimage_storage_address = preimage.public_inputs.call_context.storage_contract_address;
         const auto expected_storage_address = is_delegate_call ? our_storage_address : contract_being_called;
-        composer.do_assert(expected_storage_address == preimage_storage_address,
-                           format("call_stack_storage_address[",
-                                  i,
-                                  "] = ",
-                                  preimage_storage_address,
-                                  " expected ",
-                                  expected_storage_address,
-                                  "; does not reconcile"),
-                           CircuitErrorCode::PUBLIC_KERNEL__PUBLIC_CALL_STACK_INVALID_STORAGE_ADDRESS);
+        composer.do_assert(
+            expected_storage_address == preimage_storage_address,
+            [&]() {
+                return format("call_stack_storage_address[",
+                              i,
+                              "] = ",
+                              preimage_storage_address,
+                              " expected ",
+                              expected_storage_address,
+                              "; does not reconcile");
+            },
+            CircuitErrorCode::PUBLIC_KERNEL__PUBLIC_CALL_STACK_INVALID_STORAGE_ADDRESS);
 
         // if it is a delegate call then we check that the portal contract in the pre image is our portal contract
         const auto preimage_portal_address = preimage.public_inputs.call_context.portal_contract_address;
         const auto expected_portal_address = our_portal_contract_address;
-        composer.do_assert(!is_delegate_call || expected_portal_address == preimage_portal_address,
-                           format("call_stack_portal_address[",
-                                  i,
-                                  "] = ",
-                                  preimage_portal_address,
-                                  " expected ",
-                                  expected_portal_address,
-                                  "; does not reconcile"),
-                           CircuitErrorCode::PUBLIC_KERNEL__PUBLIC_CALL_STACK_INVALID_PORTAL_ADDRESS);
+        composer.do_assert(
+            !is_delegate_call || expected_portal_address == preimage_portal_address,
+            [&]() {
+                return format("call_stack_portal_address[",
+                              i,
+                              "] = ",
+                              preimage_portal_address,
+                              " expected ",
+                              expected_portal_address,
+                              "; does not reconcile");
+            },
+            CircuitErrorCode::PUBLIC_KERNEL__PUBLIC_CALL_STACK_INVALID_PORTAL_ADDRESS);
 
         const auto num_contract_storage_update_requests =
             array_length(preimage.public_inputs.contract_storage_update_requests);
         composer.do_assert(
             !is_static_call || num_contract_storage_update_requests == 0,
-            format("contract_storage_update_requests[", i, "] should be empty"),
+            [&]() { return format("contract_storage_update_requests[", i, "] should be empty"); },
             CircuitErrorCode::PUBLIC_KERNEL__PUBLIC_CALL_STACK_CONTRACT_STORAGE_UPDATES_PROHIBITED_FOR_STATIC_CALL);
     }
 };
@@ -230,6 +247,9 @@ void propagate_valid_public_data_update_requests(Composer& composer,
     const auto& contract_address = public_kernel_inputs.public_call.call_stack_item.contract_address;
     const auto& update_requests =
         public_kernel_inputs.public_call.call_stack_item.public_inputs.contract_storage_update_requests;
+    // track the output's length instead of rescanning it for every push
+    BoundedArray<PublicDataUpdateRequest<NT>, KERNEL_PUBLIC_DATA_UPDATE_REQUESTS_LENGTH> end_update_requests(
+        circuit_outputs.end.public_data_update_requests);
     for (size_t i = 0; i < KERNEL_PUBLIC_DATA_UPDATE_REQUESTS_LENGTH; ++i) {
         const auto& update_request = update_requests[i];
         if (update_request.is_empty()) {
@@ -240,8 +260,9 @@ void propagate_valid_public_data_update_requests(Composer& composer,
             .old_value = compute_public_data_tree_value<NT>(update_request.old_value),
             .new_value = compute_public_data_tree_value<NT>(update_request.new_value),
         };
-        array_push(composer, circuit_outputs.end.public_data_update_requests, new_write);
+        end_update_requests.push(composer, new_write);
     }
+    circuit_outputs.end.public_data_update_requests = end_update_requests.array();
 }
 
 /**
@@ -257,6 +278,7 @@ void propagate_valid_public_data_reads(Composer& composer,
 {
     const auto& contract_address = public_kernel_inputs.public_call.call_stack_item.contract_address;
     const auto& reads = public_kernel_inputs.public_call.call_stack_item.public_inputs.contract_storage_reads;
+    BoundedArray<PublicDataRead<NT>, KERNEL_PUBLIC_DATA_READS_LENGTH> end_reads(circuit_outputs.end.public_data_reads);
     for (size_t i = 0; i < KERNEL_PUBLIC_DATA_READS_LENGTH; ++i) {
         const auto& contract_storage_read = reads[i];
         if (contract_storage_read.is_empty()) {
@@ -266,8 +288,9 @@ void propagate_valid_public_data_reads(Composer& composer,
             .leaf_index = compute_public_data_tree_index<NT>(contract_address, contract_storage_read.storage_slot),
             .value = compute_public_data_tree_value<NT>(contract_storage_read.current_value),
         };
-        array_push(composer, circuit_outputs.end.public_data_reads, new_read);
+        end_reads.push(composer, new_read);
     }
+    circuit_outputs.end.public_data_reads = end_reads.array();
 }
 
 /**
@@ -1,4 +1,5 @@
 #include "init.hpp"
 #include "native_public_kernel_circuit_no_previous_kernel.hpp"
 #include "native_public_kernel_circuit_private_previous_kernel.hpp"
+#include "native_public_kernel_circuit_public_call_stack.hpp"
 #include "native_public_kernel_circuit_public_previous_kernel.hpp"
\ No newline at end of file
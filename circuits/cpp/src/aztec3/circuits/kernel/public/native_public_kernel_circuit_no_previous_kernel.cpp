@@ -109,6 +109,10 @@ KernelCircuitPublicInputs<NT> native_public_kernel_circuit_no_previous_kernel(
     // validate the kernel execution common to all invocation circumstances
     common_validate_kernel_execution(composer, public_kernel_inputs);
 
+    if (composer.should_stop()) {
+        return public_inputs;
+    }
+
     // update the public end state of the circuit
     update_public_end_values(composer, public_kernel_inputs, public_inputs);
 
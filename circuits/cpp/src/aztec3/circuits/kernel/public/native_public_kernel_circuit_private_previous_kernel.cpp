@@ -61,9 +61,17 @@ KernelCircuitPublicInputs<NT> native_public_kernel_circuit_private_previous_kern
     // validate the kernel execution common to all invocation circumstances
     common_validate_kernel_execution(composer, public_kernel_inputs);
 
+    if (composer.should_stop()) {
+        return public_inputs;
+    }
+
     // vallidate our public call hash
     validate_this_public_call_hash(composer, public_kernel_inputs, public_inputs);
 
+    if (composer.should_stop()) {
+        return public_inputs;
+    }
+
     // update the public end state of the circuit
     common_update_public_end_values(composer, public_kernel_inputs, public_inputs);
 
@@ -0,0 +1,61 @@
+#include "native_public_kernel_circuit_public_call_stack.hpp"
+
+#include "init.hpp"
+#include "native_public_kernel_circuit_private_previous_kernel.hpp"
+#include "native_public_kernel_circuit_public_previous_kernel.hpp"
+
+#include "aztec3/circuits/abis/kernel_circuit_public_inputs.hpp"
+#include "aztec3/circuits/abis/previous_kernel_data.hpp"
+#include "aztec3/circuits/abis/public_kernel/public_call_data.hpp"
+#include "aztec3/circuits/abis/public_kernel/public_kernel_inputs.hpp"
+#include "aztec3/utils/dummy_composer.hpp"
+
+namespace aztec3::circuits::kernel::public_kernel {
+
+using aztec3::circuits::abis::KernelCircuitPublicInputs;
+using aztec3::circuits::abis::PreviousKernelData;
+using aztec3::circuits::abis::public_kernel::PublicCallData;
+using aztec3::circuits::abis::public_kernel::PublicKernelInputs;
+
+using DummyComposer = aztec3::utils::DummyComposer;
+
+/**
+ * @brief Runs the native public kernel circuit over a transaction's whole public call stack
+ * @details Each entry of `public_calls` is one iteration of the public kernel. The output of an iteration is fed
+ * straight back in as the previous kernel's public inputs of the next one, so nothing is serialized in between.
+ * Every iteration pops the top of `end.public_call_stack`, so `public_calls` must be ordered the way the stack is
+ * popped (last pushed first). The first iteration dispatches on the `is_private` flag of the provided previous
+ * kernel and every later one follows the public previous kernel path.
+ * Stops at the first iteration which fails, leaving the error in the composer.
+ * @param composer The circuit composer
+ * @param previous_kernel The kernel data output by the private kernel (or by an earlier public kernel iteration)
+ * @param public_calls The public calls to execute, in call stack pop order
+ * @return The circuit public inputs of the last executed iteration
+ */
+KernelCircuitPublicInputs<NT> native_public_kernel_circuit_public_call_stack(
+    DummyComposer& composer,
+    PreviousKernelData<NT> const& previous_kernel,
+    std::vector<PublicCallData<NT>> const& public_calls)
+{
+    // The proof and vk of the provided previous kernel are carried through every iteration, only the public inputs
+    // are replaced by the output of the iteration before
+    PublicKernelInputs<NT> public_kernel_inputs{ .previous_kernel = previous_kernel };
+    auto& public_inputs = public_kernel_inputs.previous_kernel.public_inputs;
+
+    for (auto const& public_call : public_calls) {
+        public_kernel_inputs.public_call = public_call;
+
+        // the kernel builds its output from scratch before it gets assigned back over its own previous inputs
+        public_inputs = public_inputs.is_private
+                            ? native_public_kernel_circuit_private_previous_kernel(composer, public_kernel_inputs)
+                            : native_public_kernel_circuit_public_previous_kernel(composer, public_kernel_inputs);
+
+        if (composer.failed()) {
+            break;
+        }
+    }
+
+    return public_inputs;
+};
+
+}  // namespace aztec3::circuits::kernel::public_kernel
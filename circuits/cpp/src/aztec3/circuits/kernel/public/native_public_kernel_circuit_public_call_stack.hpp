@@ -0,0 +1,24 @@
+#pragma once
+
+#include "common.hpp"
+#include "init.hpp"
+
+#include "aztec3/circuits/abis/kernel_circuit_public_inputs.hpp"
+#include "aztec3/circuits/abis/previous_kernel_data.hpp"
+#include "aztec3/circuits/abis/public_kernel/public_call_data.hpp"
+#include "aztec3/utils/dummy_composer.hpp"
+
+#include <vector>
+
+namespace aztec3::circuits::kernel::public_kernel {
+
+using aztec3::circuits::abis::KernelCircuitPublicInputs;
+using aztec3::circuits::abis::PreviousKernelData;
+using aztec3::circuits::abis::public_kernel::PublicCallData;
+using DummyComposer = aztec3::utils::DummyComposer;
+
+KernelCircuitPublicInputs<NT> native_public_kernel_circuit_public_call_stack(
+    DummyComposer& composer,
+    PreviousKernelData<NT> const& previous_kernel,
+    std::vector<PublicCallData<NT>> const& public_calls);
+}  // namespace aztec3::circuits::kernel::public_kernel
@@ -0,0 +1,100 @@
+#pragma once
+
+#include "aztec3/circuits/abis/previous_kernel_data.hpp"
+#include "aztec3/utils/types/native_types.hpp"
+
+#include <barretenberg/barretenberg.hpp>
+#include <barretenberg/common/thread.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace aztec3::circuits {
+
+using NT = aztec3::utils::types::NativeTypes;
+
+/**
+ * @brief The one commitment of the mock kernel vk (see `mock/mock_kernel_proof.hpp`), by which it is told apart from a
+ * real one
+ */
+constexpr char const* MOCK_KERNEL_VK_COMMITMENT = "MOCK_KERNEL";
+
+/**
+ * @brief The size of a proof of an UltraPlonk circuit with the given number of public inputs: the bytes of every
+ * transcript element the prover sends
+ */
+inline size_t expected_kernel_proof_size(size_t num_public_inputs)
+{
+    auto const manifest = plonk::UltraPlonkComposer::create_manifest(num_public_inputs);
+    size_t size = 0;
+    for (size_t round = 0; round < manifest.get_num_rounds(); round++) {
+        for (auto const& element : manifest.get_round_manifest(round).elements) {
+            if (!element.derived_by_verifier) {
+                size += element.num_bytes;
+            }
+        }
+    }
+    return size;
+}
+
+/**
+ * @brief Whether a proof is shaped like a proof for the given vk: an UltraPlonk vk, and a proof of exactly the size its
+ * transcript has
+ * @details Cheap, and checked before the verifier reads the proof, which it would otherwise read past the end of.
+ */
+inline bool is_well_formed_kernel_proof(std::shared_ptr<NT::VK> const& vk, NT::Proof const& proof)
+{
+    return vk != nullptr && vk->composer_type == proof_system::ComposerType::PLOOKUP &&
+           proof.proof_data.size() == expected_kernel_proof_size(vk->num_public_inputs);
+}
+
+/**
+ * @brief Verifies a kernel (or any UltraPlonk) proof natively against its vk
+ * @details A mock kernel vk holds none of the commitments the verifier reads, so is rejected outright.
+ */
+inline bool verify_kernel_proof(std::shared_ptr<NT::VK> const& vk, NT::Proof const& proof)
+{
+    if (!is_well_formed_kernel_proof(vk, proof) || vk->commitments.contains(MOCK_KERNEL_VK_COMMITMENT)) {
+        return false;
+    }
+    plonk::UltraVerifier verifier(vk, plonk::UltraPlonkComposer::create_manifest(vk->num_public_inputs));
+    verifier.commitment_scheme = std::make_unique<plonk::KateCommitmentScheme<plonk::ultra_settings>>();
+    return verifier.verify_proof(proof);
+}
+
+/**
+ * @brief Verifies many kernel proofs natively, each against the vk it comes with
+ *
+ * @details Every proof is first checked to be well formed, so that kernels holding garbage are rejected before any
+ * curve arithmetic. The proofs are then verified spread over barretenberg's thread pool (sequentially when built
+ * without MULTITHREADING, e.g. WASM), and once one fails the rest are skipped. The first proof is verified on the
+ * calling thread, so that anything barretenberg builds lazily is built before any worker thread needs it.
+ *
+ * @return whether every proof verifies (true for none)
+ */
+inline bool verify_kernel_proofs(std::vector<abis::PreviousKernelData<NT>> const& kernel_data)
+{
+    for (auto const& kernel : kernel_data) {
+        if (!is_well_formed_kernel_proof(kernel.vk, kernel.proof)) {
+            return false;
+        }
+    }
+    if (kernel_data.empty()) {
+        return true;
+    }
+    if (!verify_kernel_proof(kernel_data[0].vk, kernel_data[0].proof)) {
+        return false;
+    }
+
+    std::atomic<bool> all_verified = true;
+    parallel_for(kernel_data.size() - 1, [&](size_t i) {
+        if (all_verified && !verify_kernel_proof(kernel_data[i + 1].vk, kernel_data[i + 1].proof)) {
+            all_verified = false;
+        }
+    });
+    return all_verified;
+}
+
+}  // namespace aztec3::circuits
@@ -0,0 +1,191 @@
+#pragma once
+#include "mock_kernel_circuit.hpp"
+
+#include "aztec3/circuits/abis/kernel_circuit_public_inputs.hpp"
+#include "aztec3/circuits/abis/previous_kernel_data.hpp"
+#include "aztec3/circuits/kernel_proof_verifier.hpp"
+#include "aztec3/utils/crs_factory.hpp"
+#include "aztec3/utils/types/native_types.hpp"
+
+#include <barretenberg/barretenberg.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace aztec3::circuits::mock {
+
+using aztec3::circuits::abis::KernelCircuitPublicInputs;
+using aztec3::circuits::abis::PreviousKernelData;
+using NT = aztec3::utils::types::NativeTypes;
+
+/**
+ * @brief The mock kernel circuit built from some public inputs: everything a mock proof of it is made from
+ */
+struct MockKernelCircuit {
+    KernelCircuitPublicInputs<NT> public_inputs;
+    // the circuit's public inputs as the proof holds them: 32 bytes per field element
+    std::vector<uint8_t> public_inputs_buf;
+    NT::VKData vk_data;
+};
+
+inline MockKernelCircuit build_mock_kernel_circuit(KernelCircuitPublicInputs<NT> const& public_inputs)
+{
+    plonk::UltraPlonkComposer composer = plonk::UltraPlonkComposer(aztec3::utils::get_crs_factory());
+    auto const mock_public_inputs = mock_kernel_circuit(composer, public_inputs);
+
+    auto const& public_input_indices = composer.circuit_constructor.public_inputs;
+    std::vector<uint8_t> public_inputs_buf(public_input_indices.size() * sizeof(NT::fr));
+    for (size_t i = 0; i < public_input_indices.size(); i++) {
+        NT::fr::serialize_to_buffer(composer.circuit_constructor.get_variable(public_input_indices[i]),
+                                    &public_inputs_buf[i * sizeof(NT::fr)]);
+    }
+
+    size_t circuit_size = 1;
+    while (circuit_size < composer.num_gates + public_input_indices.size()) {
+        circuit_size <<= 1;
+    }
+
+    return {
+        .public_inputs = mock_public_inputs,
+        .public_inputs_buf = public_inputs_buf,
+        .vk_data = { .composer_type = proof_system::ComposerType::PLOOKUP,
+                     .circuit_size = static_cast<uint32_t>(circuit_size),
+                     .num_public_inputs = static_cast<uint32_t>(public_input_indices.size()),
+                     .commitments = { { MOCK_KERNEL_VK_COMMITMENT, barretenberg::g1::affine_one } },
+                     .contains_recursive_proof = false,
+                     .recursive_proof_public_input_indices = {} },
+    };
+}
+
+/**
+ * @brief The vk of every mock kernel proof
+ *
+ * @details Shaped like a kernel vk (UltraPlonk, with the kernel's number of public inputs), so that mock proofs pass
+ * `is_well_formed_kernel_proof`, but holding only `MOCK_KERNEL_VK_COMMITMENT`, with which no real verifier accepts a
+ * proof.
+ */
+inline NT::VKData mock_kernel_vk_data()
+{
+    return build_mock_kernel_circuit(KernelCircuitPublicInputs<NT>{}).vk_data;
+}
+
+/**
+ * @brief A mock proof with the given public inputs: laid out like an UltraPlonk proof, of exactly its size
+ *
+ * @details Every commitment is the bn254 generator and every evaluation a blake2s hash of the public inputs (with its
+ * top byte cleared, so that it is a field element), so the proof is bound to its public inputs and any change to them
+ * is caught by `verify_mock_kernel_proof`.
+ */
+inline NT::Proof mock_kernel_proof(std::vector<uint8_t> const& public_inputs_buf)
+{
+    auto evaluation = blake2::blake2s(public_inputs_buf);
+    evaluation[0] = 0;
+
+    std::vector<uint8_t> commitment(2 * sizeof(NT::fq));
+    NT::fq::serialize_to_buffer(barretenberg::g1::affine_one.x, &commitment[0]);
+    NT::fq::serialize_to_buffer(barretenberg::g1::affine_one.y, &commitment[sizeof(NT::fq)]);
+
+    auto const manifest = plonk::UltraPlonkComposer::create_manifest(public_inputs_buf.size() / sizeof(NT::fr));
+    std::vector<uint8_t> proof_data;
+    for (size_t round = 0; round < manifest.get_num_rounds(); round++) {
+        for (auto const& element : manifest.get_round_manifest(round).elements) {
+            if (element.derived_by_verifier) {
+                continue;
+            }
+            if (element.name == "public_inputs") {
+                proof_data.insert(proof_data.end(), public_inputs_buf.begin(), public_inputs_buf.end());
+            } else if (element.num_bytes == commitment.size()) {
+                proof_data.insert(proof_data.end(), commitment.begin(), commitment.end());
+            } else {
+                for (size_t written = 0; written < element.num_bytes; written += evaluation.size()) {
+                    auto const num_bytes = std::min(evaluation.size(), element.num_bytes - written);
+                    auto const evaluation_end = evaluation.begin() + static_cast<std::ptrdiff_t>(num_bytes);
+                    proof_data.insert(proof_data.end(), evaluation.begin(), evaluation_end);
+                }
+            }
+        }
+    }
+    return { .proof_data = proof_data };
+}
+
+/**
+ * @brief A previous kernel with a mock proof in place of a real one: the public inputs of the mock kernel circuit built
+ * from `public_inputs`, a mock proof of them, and the mock kernel vk
+ *
+ * @details Costs building the (small) mock kernel circuit and a hash, against proving the kernel for a real one.
+ */
+inline PreviousKernelData<NT> mock_previous_kernel(KernelCircuitPublicInputs<NT> const& public_inputs)
+{
+    auto circuit = build_mock_kernel_circuit(public_inputs);
+    return {
+        .public_inputs = circuit.public_inputs,
+        .proof = mock_kernel_proof(circuit.public_inputs_buf),
+        .vk = std::make_shared<NT::VK>(std::move(circuit.vk_data), nullptr),
+    };
+}
+
+inline bool is_mock_kernel_vk(std::shared_ptr<NT::VK> const& vk)
+{
+    return vk != nullptr && vk->commitments.contains(MOCK_KERNEL_VK_COMMITMENT);
+}
+
+/**
+ * @brief Accepts exactly the proofs `mock_kernel_proof` makes, against the mock kernel vk
+ *
+ * @details Reads the public inputs out of the proof and checks it is the mock proof of them, without any curve
+ * arithmetic.
+ */
+inline bool verify_mock_kernel_proof(std::shared_ptr<NT::VK> const& vk, NT::Proof const& proof)
+{
+    if (!is_mock_kernel_vk(vk) || !is_well_formed_kernel_proof(vk, proof)) {
+        return false;
+    }
+
+    auto const manifest = plonk::UltraPlonkComposer::create_manifest(vk->num_public_inputs);
+    size_t offset = 0;
+    for (size_t round = 0; round < manifest.get_num_rounds(); round++) {
+        for (auto const& element : manifest.get_round_manifest(round).elements) {
+            if (element.derived_by_verifier) {
+                continue;
+            }
+            if (element.name == "public_inputs") {
+                auto const public_inputs_begin = proof.proof_data.begin() + static_cast<std::ptrdiff_t>(offset);
+                std::vector<uint8_t> const public_inputs_buf(
+                    public_inputs_begin, public_inputs_begin + static_cast<std::ptrdiff_t>(element.num_bytes));
+                return mock_kernel_proof(public_inputs_buf).proof_data == proof.proof_data;
+            }
+            offset += element.num_bytes;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief Accepts a previous kernel only if its proof is the mock proof of its own `public_inputs`
+ *
+ * @details `verify_mock_kernel_proof` only checks that a proof is the mock proof of the public inputs it carries. This
+ * also rebuilds the mock kernel circuit from the kernel's public inputs, so that a mock proof of other public inputs
+ * is rejected, as a real verifier would reject it.
+ */
+inline bool verify_mock_previous_kernel(PreviousKernelData<NT> const& kernel)
+{
+    if (!is_mock_kernel_vk(kernel.vk) || !is_well_formed_kernel_proof(kernel.vk, kernel.proof)) {
+        return false;
+    }
+    auto const circuit = build_mock_kernel_circuit(kernel.public_inputs);
+    return mock_kernel_proof(circuit.public_inputs_buf).proof_data == kernel.proof.proof_data;
+}
+
+/**
+ * @brief As `verify_kernel_proofs`, for mock proofs
+ * @return whether every proof is the mock proof of its kernel's public inputs (true for none)
+ */
+inline bool verify_mock_kernel_proofs(std::vector<PreviousKernelData<NT>> const& kernel_data)
+{
+    return std::all_of(kernel_data.begin(), kernel_data.end(), verify_mock_previous_kernel);
+}
+
+}  // namespace aztec3::circuits::mock
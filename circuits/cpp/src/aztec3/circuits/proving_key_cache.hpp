@@ -0,0 +1,401 @@
+#pragma once
+
+#include "aztec3/utils/crs_factory.hpp"
+#include "aztec3/utils/lru_cache.hpp"
+
+#include <barretenberg/barretenberg.hpp>
+#include <barretenberg/plonk/proof_system/proving_key/serialize.hpp>
+
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace aztec3::circuits {
+
+using aztec3::utils::CacheLock;
+using aztec3::utils::CacheMutex;
+using aztec3::utils::CacheStats;
+
+/**
+ * @brief The circuits whose proving keys are cached, as tagged in the serialized proving keys
+ * @details The private kernel's first iteration and its inner iterations build different circuits, so each has its
+ * own key.
+ */
+enum class ProvingKeyCircuit : uint32_t { PRIVATE_KERNEL_INIT = 0, PRIVATE_KERNEL_INNER = 1 };
+constexpr uint32_t NUM_PROVING_KEY_CIRCUITS = 2;
+
+// "AZPK", which tells serialized proving keys apart from e.g. an unset pointer argument
+constexpr uint32_t PROVING_KEYS_MAGIC = 0x415a504b;
+// bump whenever the layout below, or barretenberg's serialization of a proving key, changes
+constexpr uint32_t PROVING_KEYS_FORMAT_VERSION = 2;
+// the index file of a proving key directory, next to one subdirectory of polynomials per key
+constexpr char const* PROVING_KEYS_INDEX_FILE_NAME = "proving_keys";
+
+/**
+ * @brief What a circuit's structure depends on, besides the circuit itself: the vks of the proofs it verifies
+ * @details A recursive verifier's gates depend on the number of public inputs of the proof it verifies and on whether
+ * that proof itself carries a recursive proof, but not on any other value of its vk or of its proof.
+ */
+struct CircuitShape {
+    uint32_t num_private_call_public_inputs = 0;
+    bool private_call_contains_recursive_proof = false;
+    uint32_t num_previous_kernel_public_inputs = 0;
+    bool previous_kernel_contains_recursive_proof = false;
+
+    auto operator<=>(CircuitShape const&) const = default;
+};
+
+template <typename B> void read(B& it, CircuitShape& shape)
+{
+    using serialize::read;
+    read(it, shape.num_private_call_public_inputs);
+    read(it, shape.private_call_contains_recursive_proof);
+    read(it, shape.num_previous_kernel_public_inputs);
+    read(it, shape.previous_kernel_contains_recursive_proof);
+}
+
+template <typename B> void write(B& buf, CircuitShape const& shape)
+{
+    using serialize::write;
+    write(buf, shape.num_private_call_public_inputs);
+    write(buf, shape.private_call_contains_recursive_proof);
+    write(buf, shape.num_previous_kernel_public_inputs);
+    write(buf, shape.previous_kernel_contains_recursive_proof);
+}
+
+/**
+ * @brief A fingerprint of a built circuit's structure: the selectors and wiring of its gates, its copy constraints and
+ * its public inputs, but none of its witness values
+ * @details Taken before the prover finalizes the circuit (which adds gates of its own), so that a circuit built for a
+ * cached key is compared with the one the key was computed from at the same point. FNV-1a: it tells apart circuits
+ * built differently by mistake, and is not meant to withstand crafted ones.
+ */
+template <typename Composer> uint64_t circuit_structure_hash(Composer const& composer)
+{
+    uint64_t hash = 0xcbf29ce484222325ULL;
+    auto const add_bytes = [&](void const* data, size_t size) {
+        auto const* bytes = static_cast<uint8_t const*>(data);
+        for (size_t i = 0; i < size; i++) {
+            hash = (hash ^ bytes[i]) * 0x100000001b3ULL;
+        }
+    };
+    auto const add = [&](auto const& values) {
+        uint64_t const size = values.size();
+        add_bytes(&size, sizeof(size));
+        add_bytes(values.data(), values.size() * sizeof(values[0]));
+    };
+
+    auto const& constructor = composer.circuit_constructor;
+    add(constructor.w_l);
+    add(constructor.w_r);
+    add(constructor.w_o);
+    add(constructor.w_4);
+    for (auto const* selector : { &constructor.q_m,
+                                  &constructor.q_c,
+                                  &constructor.q_1,
+                                  &constructor.q_2,
+                                  &constructor.q_3,
+                                  &constructor.q_4,
+                                  &constructor.q_arith,
+                                  &constructor.q_sort,
+                                  &constructor.q_elliptic,
+                                  &constructor.q_aux,
+                                  &constructor.q_lookup_type }) {
+        add(*selector);
+    }
+    add(constructor.real_variable_index);
+    add(constructor.public_inputs);
+    return hash;
+}
+
+/**
+ * @brief A cached proving key, with the verification key, the number of gates and the structure hash (see
+ * `circuit_structure_hash`) of the circuit it was computed from
+ *
+ * @details Building a circuit of the same shape must give the same structure. A circuit which does not is not the one
+ * the key is for, and must not be proven with it.
+ *
+ * Proving writes the proof's witness polynomials into the key's polynomial store, so a key is only ever proven with
+ * (or serialized) under its `prover_mutex`, which every copy of the entry shares.
+ */
+struct CachedProvingKey {
+    std::shared_ptr<plonk::proving_key> key;
+    std::shared_ptr<plonk::verification_key> vk;
+    uint64_t num_gates = 0;
+    uint64_t structure_hash = 0;
+    std::shared_ptr<CacheMutex> prover_mutex = std::make_shared<CacheMutex>();
+};
+
+/**
+ * @brief The proving keys of the circuits we prove, so that only the witness and the proof itself are computed per
+ * proof
+ *
+ * @details A key holds everything about its circuit which does not depend on the witness: the selector and
+ * permutation polynomials (in both forms) and the lookup tables. It is computed by the first proof of each circuit
+ * and shape (or read back from an earlier process) and reused for every later proof of the same circuit and shape,
+ * which then only computes its witness polynomials.
+ *
+ * Serialized, the keys are a `uint32` magic, a `uint32` format version and a `uint32` count, followed by each key as
+ * its `uint32` circuit tag, its `CircuitShape`, its `uint64` gate count, its `uint64` structure hash, barretenberg's
+ * serialization of its verification key and barretenberg's serialization of the key.
+ * Keys with a different magic or version are ignored, and so recomputed, rather than misread. `save` writes the same
+ * layout to a directory, but with each key's polynomials in files of their own which `load` then memory-maps instead
+ * of reading.
+ *
+ * All members may be called concurrently. The keys handed out are shared: a prover holds the entry's
+ * `prover_mutex` while proving with one, and serializing a key holds it too. Barretenberg serializes only a key's
+ * precomputed polynomials, so the witness left in a key by its last proof is never written out.
+ */
+class ProvingKeyCache {
+  public:
+    /**
+     * @return the key cached for the circuit of the given shape, if any (else with a null `key`)
+     */
+    [[nodiscard]] CachedProvingKey get(ProvingKeyCircuit circuit, CircuitShape const& shape) const
+    {
+        CacheLock const lock(mutex);
+        auto const it = keys.find({ circuit, shape });
+        return it == keys.end() ? CachedProvingKey{} : it->second;
+    }
+
+    void put(ProvingKeyCircuit circuit, CircuitShape const& shape, CachedProvingKey key)
+    {
+        CacheLock const lock(mutex);
+        latest_vks[circuit] = key.vk;
+        keys[{ circuit, shape }] = std::move(key);
+    }
+
+    /**
+     * @return the verification key of the key most recently cached for the circuit (computed by a proof, or added from
+     * serialized keys), if any (else null)
+     * @details A circuit's keys differ in shape only when the proofs it verifies do, which for a kernel proven the same
+     * way each time they don't: its keys then all share this verification key.
+     */
+    [[nodiscard]] std::shared_ptr<plonk::verification_key> get_verification_key(ProvingKeyCircuit circuit) const
+    {
+        CacheLock const lock(mutex);
+        auto const it = latest_vks.find(circuit);
+        return it == latest_vks.end() ? nullptr : it->second;
+    }
+
+    /**
+     * @brief Counts a proof made with a cached key (a hit), or from a full rebuild (a miss): one for which no key was
+     * cached, or whose circuit's structure did not match the cached key's
+     */
+    void record_proof(bool with_cached_key)
+    {
+        CacheLock const lock(mutex);
+        (with_cached_key ? hits : misses)++;
+    }
+
+    /**
+     * @return the proofs counted by `record_proof` and the number of keys held (the cache is unbounded, so its capacity
+     * is 0)
+     */
+    [[nodiscard]] CacheStats stats() const
+    {
+        CacheLock const lock(mutex);
+        return { .hits = hits, .misses = misses, .size = keys.size(), .capacity = 0 };
+    }
+
+    /**
+     * @brief Serializes every key held
+     */
+    [[nodiscard]] std::vector<uint8_t> to_buffer() const
+    {
+        using serialize::write;
+
+        auto const held_keys = get_all();
+        std::vector<uint8_t> buf;
+        write(buf, PROVING_KEYS_MAGIC);
+        write(buf, PROVING_KEYS_FORMAT_VERSION);
+        write(buf, static_cast<uint32_t>(held_keys.size()));
+        for (auto const& [id, cached] : held_keys) {
+            write_entry_header(buf, id, cached);
+            CacheLock const key_lock(*cached.prover_mutex);
+            write(buf, *cached.key);
+        }
+        return buf;
+    }
+
+    /**
+     * @brief Adds the keys serialized in `buf` by `to_buffer`, replacing any held for the same circuits and shapes
+     * @return the number of keys added: 0 if `buf` does not hold proving keys in this version of the format
+     */
+    size_t from_buffer(uint8_t const* buf)
+    {
+        using serialize::read;
+
+        uint32_t num_keys = 0;
+        if (!read_header(buf, num_keys)) {
+            return 0;
+        }
+        size_t num_read = 0;
+        for (; num_read < num_keys; num_read++) {
+            KeyId id{};
+            CachedProvingKey cached;
+            if (!read_entry_header(buf, id, cached)) {
+                // the keys are not length-prefixed, so there is no stepping over one we don't know
+                break;
+            }
+            plonk::proving_key_data key_data;
+            read(buf, key_data);
+            cached.key = make_key(std::move(key_data));
+            put(id.circuit, id.shape, std::move(cached));
+        }
+        return num_read;
+    }
+
+    /**
+     * @brief Writes every key held to the directory `dir`, which is created if need be
+     * @return the number of keys written
+     */
+    size_t save(std::string const& dir) const
+    {
+        using serialize::write;
+
+        auto const held_keys = get_all();
+        std::filesystem::create_directories(dir);
+        std::ofstream index(std::filesystem::path(dir) / PROVING_KEYS_INDEX_FILE_NAME, std::ios::binary);
+        write(index, PROVING_KEYS_MAGIC);
+        write(index, PROVING_KEYS_FORMAT_VERSION);
+        write(index, static_cast<uint32_t>(held_keys.size()));
+        size_t key_index = 0;
+        for (auto const& [id, cached] : held_keys) {
+            auto const polynomials_dir = polynomials_path(dir, key_index++);
+            std::filesystem::create_directories(polynomials_dir);
+            write_entry_header(index, id, cached);
+            CacheLock const key_lock(*cached.prover_mutex);
+            write_mmap(index, polynomials_dir, *cached.key);
+        }
+        return held_keys.size();
+    }
+
+    /**
+     * @brief Adds the keys written to `dir` by `save`, with their polynomials memory-mapped from its files
+     * @return the number of keys added: 0 if `dir` does not hold proving keys in this version of the format
+     */
+    size_t load(std::string const& dir)
+    {
+        std::ifstream index(std::filesystem::path(dir) / PROVING_KEYS_INDEX_FILE_NAME, std::ios::binary);
+        if (!index.good()) {
+            return 0;
+        }
+        uint32_t num_keys = 0;
+        if (!read_header(index, num_keys)) {
+            return 0;
+        }
+        size_t num_read = 0;
+        for (; num_read < num_keys; num_read++) {
+            KeyId id{};
+            CachedProvingKey cached;
+            if (!read_entry_header(index, id, cached)) {
+                break;
+            }
+            plonk::proving_key_data key_data;
+            read_mmap(index, polynomials_path(dir, num_read), key_data);
+            cached.key = make_key(std::move(key_data));
+            put(id.circuit, id.shape, std::move(cached));
+        }
+        return num_read;
+    }
+
+  private:
+    struct KeyId {
+        ProvingKeyCircuit circuit;
+        CircuitShape shape;
+
+        auto operator<=>(KeyId const&) const = default;
+    };
+    using Keys = std::map<KeyId, CachedProvingKey>;
+
+    [[nodiscard]] Keys get_all() const
+    {
+        CacheLock const lock(mutex);
+        return keys;
+    }
+
+    template <typename B> static bool read_header(B& it, uint32_t& num_keys)
+    {
+        using serialize::read;
+
+        uint32_t magic = 0;
+        read(it, magic);
+        if (magic != PROVING_KEYS_MAGIC) {
+            return false;
+        }
+        uint32_t version = 0;
+        read(it, version);
+        if (version != PROVING_KEYS_FORMAT_VERSION) {
+            return false;
+        }
+        read(it, num_keys);
+        return true;
+    }
+
+    template <typename B> static void write_entry_header(B& buf, KeyId const& id, CachedProvingKey const& cached)
+    {
+        using serialize::write;
+
+        write(buf, static_cast<uint32_t>(id.circuit));
+        write(buf, id.shape);
+        write(buf, cached.num_gates);
+        write(buf, cached.structure_hash);
+        write(buf, *cached.vk);
+    }
+
+    template <typename B> static bool read_entry_header(B& it, KeyId& id, CachedProvingKey& cached)
+    {
+        using serialize::read;
+
+        uint32_t tag = 0;
+        read(it, tag);
+        if (tag >= NUM_PROVING_KEY_CIRCUITS) {
+            return false;
+        }
+        id.circuit = static_cast<ProvingKeyCircuit>(tag);
+        read(it, id.shape);
+        read(it, cached.num_gates);
+        read(it, cached.structure_hash);
+        plonk::verification_key_data vk_data;
+        read(it, vk_data);
+        cached.vk = std::make_shared<plonk::verification_key>(std::move(vk_data),
+                                                              aztec3::utils::get_crs_factory()->get_verifier_crs());
+        return true;
+    }
+
+    static std::string polynomials_path(std::string const& dir, size_t key_index)
+    {
+        return (std::filesystem::path(dir) / std::to_string(key_index)).string();
+    }
+
+    static std::shared_ptr<plonk::proving_key> make_key(plonk::proving_key_data&& key_data)
+    {
+        auto crs = aztec3::utils::get_crs_factory()->get_prover_crs(key_data.circuit_size + 1);
+        return std::make_shared<plonk::proving_key>(std::move(key_data), crs);
+    }
+
+    mutable CacheMutex mutex;
+    Keys keys;
+    std::map<ProvingKeyCircuit, std::shared_ptr<plonk::verification_key>> latest_vks;
+    size_t hits = 0;
+    size_t misses = 0;
+};
+
+/**
+ * @brief The process-wide proving key cache
+ */
+inline ProvingKeyCache& get_proving_key_cache()
+{
+    static ProvingKeyCache cache;
+    return cache;
+}
+
+}  // namespace aztec3::circuits
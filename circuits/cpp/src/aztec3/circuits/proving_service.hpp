@@ -0,0 +1,302 @@
+#pragma once
+
+#include "aztec3/utils/hash_tables.hpp"
+#include "aztec3/utils/thread_safe_crs_factory.hpp"
+#include "aztec3/utils/types/native_types.hpp"
+
+#include <barretenberg/barretenberg.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <optional>
+#include <set>
+#include <utility>
+#include <vector>
+#ifndef NO_MULTITHREADING
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#endif
+
+namespace aztec3::circuits {
+
+using NT = aztec3::utils::types::NativeTypes;
+
+/**
+ * @brief The order in which queued proving jobs are started: every queued LATENCY_CRITICAL job (e.g. a client's
+ * kernel proof) before any queued BATCH job
+ */
+enum class ProvingPriority : uint8_t { BATCH = 0, LATENCY_CRITICAL = 1 };
+
+enum class ProvingJobStatus : uint8_t {
+    QUEUED = 0,
+    RUNNING = 1,
+    DONE = 2,
+    FAILED = 3,
+    CANCELLED = 4,
+    // never submitted, or already collected by `wait`
+    UNKNOWN = 5,
+};
+
+using ProvingJobId = uint64_t;
+
+#ifndef NO_MULTITHREADING
+// Single threaded builds (e.g. WASM) have no threads to run the jobs on
+
+/**
+ * @brief Runs proving jobs on a fixed pool of worker threads, with at most `memory_budget` bytes of (estimated) peak
+ * memory in use by the running jobs at any time
+ *
+ * @details A proof allocates far more than a core's share of a machine's memory, so running as many proofs as there
+ * are cores can run it out of memory. Every job is submitted with an estimate of its peak memory, and a job is only
+ * started once its estimate fits in what the running jobs leave of the budget. A job estimated above the whole
+ * budget is started alone, once nothing else runs.
+ *
+ * Queued jobs are started by priority, then in submission order. A job which does not fit yet holds back every job
+ * queued after it, however small, so that a large job is not starved by a stream of smaller ones. A running proof
+ * cannot be interrupted: a LATENCY_CRITICAL job overtakes the queued BATCH jobs, and runs as soon as enough of the
+ * running ones finish.
+ *
+ * A finished (or cancelled) job is kept for `wait` to collect for `finished_job_retention`, after which it is
+ * forgotten, as if collected, by the next `submit`: a job nobody waits for does not stay in the service forever.
+ *
+ * The hashing tables barretenberg builds lazily (and not under a lock) are built before any worker starts. So that
+ * jobs may load prover CRSs at the same time, the CRS factory `get_crs_factory` hands out is made thread safe (see
+ * `ThreadSafeCrsFactory`): construct the service once the CRS is initialised, and have jobs prove with that factory.
+ *
+ * All members may be called concurrently. Destroying the service cancels the queued jobs and waits for the running
+ * ones to finish.
+ */
+class ProvingService {
+  public:
+    using ProveFn = std::function<NT::Proof()>;
+    using Clock = std::chrono::steady_clock;
+
+    static constexpr Clock::duration DEFAULT_FINISHED_JOB_RETENTION = std::chrono::minutes(10);
+
+    ProvingService(size_t num_workers,
+                   size_t memory_budget,
+                   Clock::duration finished_job_retention = DEFAULT_FINISHED_JOB_RETENTION)
+        : memory_budget(memory_budget)
+        , finished_job_retention(finished_job_retention)
+    {
+        aztec3::utils::init_hash_tables();
+        aztec3::utils::init_circuit_hash_tables();
+        aztec3::utils::init_thread_safe_crs_factory();
+
+        workers.reserve(num_workers);
+        for (size_t i = 0; i < num_workers; i++) {
+            workers.emplace_back([this]() { run_worker(); });
+        }
+    }
+
+    ~ProvingService()
+    {
+        {
+            std::lock_guard<std::mutex> const lock(mutex);
+            stopping = true;
+            for (auto const& queued : queue) {
+                finish(jobs.at(queued.id), ProvingJobStatus::CANCELLED);
+            }
+            queue.clear();
+        }
+        work_available.notify_all();
+        job_finished.notify_all();
+        for (auto& worker : workers) {
+            worker.join();
+        }
+    }
+
+    ProvingService(ProvingService const&) = delete;
+    ProvingService(ProvingService&&) = delete;
+    ProvingService& operator=(ProvingService const&) = delete;
+    ProvingService& operator=(ProvingService&&) = delete;
+
+    /**
+     * @brief Queues a job, and forgets the finished jobs kept for longer than `finished_job_retention`
+     * @param prove computes the proof, on a worker thread. A job which throws fails.
+     * @param memory_estimate the peak memory of `prove`, in bytes
+     * @param priority see `ProvingPriority`
+     * @return the job's id, for `status`, `wait` and `cancel`
+     */
+    ProvingJobId submit(ProveFn prove, size_t memory_estimate, ProvingPriority priority)
+    {
+        ProvingJobId id = 0;
+        {
+            std::lock_guard<std::mutex> const lock(mutex);
+            forget_expired_jobs();
+            id = next_id++;
+            jobs.emplace(id,
+                         Job{ .prove = std::move(prove),
+                              .memory_estimate = memory_estimate,
+                              .priority = priority,
+                              .status = ProvingJobStatus::QUEUED,
+                              .proof = std::nullopt,
+                              .finished_at = {} });
+            queue.insert({ .priority = priority, .id = id });
+        }
+        work_available.notify_all();
+        return id;
+    }
+
+    [[nodiscard]] ProvingJobStatus status(ProvingJobId id) const
+    {
+        std::lock_guard<std::mutex> const lock(mutex);
+        auto const it = jobs.find(id);
+        return it == jobs.end() ? ProvingJobStatus::UNKNOWN : it->second.status;
+    }
+
+    /**
+     * @brief Waits for a job to finish (or be cancelled), and collects it
+     * @details The service forgets the job once collected, after which its status is UNKNOWN.
+     * @return the job's proof, or nothing if it failed, was cancelled or is unknown (e.g. expired)
+     */
+    std::optional<NT::Proof> wait(ProvingJobId id)
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        job_finished.wait(lock, [&]() {
+            auto const it = jobs.find(id);
+            return it == jobs.end() || is_finished(it->second.status);
+        });
+        auto const it = jobs.find(id);
+        if (it == jobs.end()) {
+            return std::nullopt;
+        }
+        auto proof = std::move(it->second.proof);
+        jobs.erase(it);
+        return proof;
+    }
+
+    /**
+     * @brief Cancels a job which has not started yet
+     * @return whether the job was cancelled: a running or finished job is not
+     */
+    bool cancel(ProvingJobId id)
+    {
+        {
+            std::lock_guard<std::mutex> const lock(mutex);
+            auto const it = jobs.find(id);
+            if (it == jobs.end() || it->second.status != ProvingJobStatus::QUEUED) {
+                return false;
+            }
+            queue.erase({ .priority = it->second.priority, .id = id });
+            finish(it->second, ProvingJobStatus::CANCELLED);
+        }
+        // the next job in the queue may fit where the cancelled one did not
+        work_available.notify_all();
+        job_finished.notify_all();
+        return true;
+    }
+
+  private:
+    struct Job {
+        ProveFn prove;
+        size_t memory_estimate;
+        ProvingPriority priority;
+        ProvingJobStatus status;
+        std::optional<NT::Proof> proof;
+        Clock::time_point finished_at;
+    };
+
+    struct QueuedJob {
+        ProvingPriority priority;
+        ProvingJobId id;
+
+        bool operator<(QueuedJob const& other) const
+        {
+            if (priority != other.priority) {
+                return priority > other.priority;
+            }
+            return id < other.id;
+        }
+    };
+
+    static bool is_finished(ProvingJobStatus status)
+    {
+        return status != ProvingJobStatus::QUEUED && status != ProvingJobStatus::RUNNING;
+    }
+
+    // with the lock held
+    static void finish(Job& job, ProvingJobStatus status)
+    {
+        job.status = status;
+        job.finished_at = Clock::now();
+    }
+
+    // with the lock held
+    void forget_expired_jobs()
+    {
+        auto const now = Clock::now();
+        std::erase_if(jobs, [&](auto const& id_and_job) {
+            auto const& job = id_and_job.second;
+            return is_finished(job.status) && now - job.finished_at >= finished_job_retention;
+        });
+    }
+
+    // with the lock held
+    [[nodiscard]] bool can_start_next() const
+    {
+        if (queue.empty()) {
+            return false;
+        }
+        size_t const memory_estimate = jobs.at(queue.begin()->id).memory_estimate;
+        return memory_in_use == 0 || memory_in_use + memory_estimate <= memory_budget;
+    }
+
+    void run_worker()
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        while (true) {
+            work_available.wait(lock, [&]() { return stopping || can_start_next(); });
+            if (stopping) {
+                return;
+            }
+
+            ProvingJobId const id = queue.begin()->id;
+            queue.erase(queue.begin());
+            auto& job = jobs.at(id);
+            job.status = ProvingJobStatus::RUNNING;
+            size_t const memory_estimate = job.memory_estimate;
+            memory_in_use += memory_estimate;
+            ProveFn const prove = std::move(job.prove);
+
+            lock.unlock();
+            std::optional<NT::Proof> proof;
+            try {
+                proof = prove();
+            } catch (...) {
+                proof = std::nullopt;
+            }
+            lock.lock();
+
+            // a running job is never collected, so it is still there
+            auto& finished_job = jobs.at(id);
+            finished_job.proof = std::move(proof);
+            finish(finished_job, finished_job.proof ? ProvingJobStatus::DONE : ProvingJobStatus::FAILED);
+            memory_in_use -= memory_estimate;
+
+            job_finished.notify_all();
+            work_available.notify_all();
+        }
+    }
+
+    size_t const memory_budget;
+    Clock::duration const finished_job_retention;
+    size_t memory_in_use = 0;
+    bool stopping = false;
+    ProvingJobId next_id = 0;
+    std::map<ProvingJobId, Job> jobs;
+    std::set<QueuedJob> queue;
+
+    mutable std::mutex mutex;
+    std::condition_variable work_available;
+    std::condition_variable job_finished;
+    std::vector<std::thread> workers;
+};
+
+#endif
+
+}  // namespace aztec3::circuits
@@ -6,8 +6,21 @@
 
 #include <barretenberg/barretenberg.hpp>
 
+#include <map>
+#include <memory>
+#include <vector>
+
 namespace aztec3::circuits::recursion {
 
+/**
+ * @brief A proof to be verified in-circuit, with the vk it is verified against
+ */
+template <typename VK> struct ProofToAggregate {
+    std::shared_ptr<VK> vk;
+    NT::Proof proof;
+    size_t num_public_inputs;
+};
+
 class Aggregator {
   public:
     static CT::AggregationObject aggregate(
@@ -24,5 +37,57 @@ class Aggregator {
 
         return result;
     }
+
+    /**
+     * @brief Verifies every proof in one pass, accumulating them all into one aggregation object
+     *
+     * @details Each proof folds the aggregation object of the proofs before it into its own final multi-scalar
+     * multiplication, under a separator challenge drawn from its own transcript, so the k proofs cost k recursive
+     * verifications and no separate folding step. Manifests are built once per distinct number of public inputs.
+     */
+    static CT::AggregationObject aggregate_all(
+        Composer* composer,
+        std::vector<ProofToAggregate<CT::VK>> const& proofs,
+        const CT::AggregationObject& previous_aggregation_output = CT::AggregationObject())
+    {
+        std::map<size_t, Manifest> manifests;
+        CT::AggregationObject result = previous_aggregation_output;
+        for (auto const& to_aggregate : proofs) {
+            auto manifest = manifests.find(to_aggregate.num_public_inputs);
+            if (manifest == manifests.end()) {
+                manifest = manifests
+                               .emplace(to_aggregate.num_public_inputs,
+                                        Composer::create_manifest(to_aggregate.num_public_inputs))
+                               .first;
+            }
+            result = verify_proof<CT::bn254, CT::recursive_inner_verifier_settings>(
+                composer, to_aggregate.vk, manifest->second, to_aggregate.proof, result);
+        }
+        return result;
+    }
+
+    /**
+     * @brief As above, from native vks, each distinct one of which is made a witness only once
+     *
+     * @details Kernels absorbing several proofs of the same circuit then pay for that circuit's vk commitments (and
+     * their range constraints) once rather than once per proof.
+     */
+    static CT::AggregationObject aggregate_all(
+        Composer* composer,
+        std::vector<ProofToAggregate<NT::VK>> const& proofs,
+        const CT::AggregationObject& previous_aggregation_output = CT::AggregationObject())
+    {
+        std::map<NT::VK const*, std::shared_ptr<CT::VK>> vks;
+        std::vector<ProofToAggregate<CT::VK>> ct_proofs;
+        ct_proofs.reserve(proofs.size());
+        for (auto const& to_aggregate : proofs) {
+            auto& vk = vks[to_aggregate.vk.get()];
+            if (vk == nullptr) {
+                vk = CT::VK::from_witness(composer, to_aggregate.vk);
+            }
+            ct_proofs.push_back({ vk, to_aggregate.proof, to_aggregate.num_public_inputs });
+        }
+        return aggregate_all(composer, ct_proofs, previous_aggregation_output);
+    }
 };
-}  // namespace aztec3::circuits::recursion
\ No newline at end of file
+}  // namespace aztec3::circuits::recursion
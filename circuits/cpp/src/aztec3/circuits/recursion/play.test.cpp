@@ -56,6 +56,60 @@ TEST_F(play_tests, circuit_play_recursive_proof_gen)
     }
 }
 
+/**
+ * @brief `aggregate_all` is the same k recursive verifications as k calls to `aggregate`, and so costs the same gates,
+ * but for making each distinct vk a witness only once
+ * @details Nothing is batched: only proofs sharing a vk save anything. The private kernel verifies one proof of each
+ * of two different circuits, and so saves no gates by it.
+ */
+TEST_F(play_tests, circuit_aggregate_all_matches_sequential_aggregation_with_one_vk_witness)
+{
+    Composer app_composer = Composer(barretenberg::srs::get_crs_factory());
+    play_app_circuit(app_composer, 1, 2);
+    auto app_prover = app_composer.create_prover();
+    proof const app_proof = app_prover.construct_proof();
+    std::shared_ptr<plonk::verification_key> const app_vk = app_composer.compute_verification_key();
+
+    // a kernel absorbing several proofs of the same app circuit
+    size_t const num_proofs = 3;
+
+    // k sequential calls, each proof coming with its own vk witness, as `play_recursive_circuit` does
+    Composer sequential_composer = Composer(barretenberg::srs::get_crs_factory());
+    CT::AggregationObject sequential_output;
+    for (size_t i = 0; i < num_proofs; i++) {
+        std::shared_ptr<CT::VK> const app_vk_ct = CT::VK::from_witness(&sequential_composer, app_vk);
+        sequential_output = Aggregator::aggregate(
+            &sequential_composer, app_vk_ct, app_proof, app_vk->num_public_inputs, sequential_output);
+    }
+
+    // k sequential calls sharing one vk witness
+    Composer shared_vk_composer = Composer(barretenberg::srs::get_crs_factory());
+    std::shared_ptr<CT::VK> const shared_vk_ct = CT::VK::from_witness(&shared_vk_composer, app_vk);
+    CT::AggregationObject shared_vk_output;
+    for (size_t i = 0; i < num_proofs; i++) {
+        shared_vk_output = Aggregator::aggregate(
+            &shared_vk_composer, shared_vk_ct, app_proof, app_vk->num_public_inputs, shared_vk_output);
+    }
+
+    Composer aggregate_all_composer = Composer(barretenberg::srs::get_crs_factory());
+    std::vector<ProofToAggregate<NT::VK>> const proofs(num_proofs, { app_vk, app_proof, app_vk->num_public_inputs });
+    CT::AggregationObject const aggregate_all_output = Aggregator::aggregate_all(&aggregate_all_composer, proofs);
+
+    info("gates for ", num_proofs, " sequential aggregations: ", sequential_composer.num_gates);
+    info("gates for one aggregate_all of ", num_proofs, " proofs: ", aggregate_all_composer.num_gates);
+
+    EXPECT_FALSE(sequential_composer.failed());
+    EXPECT_FALSE(shared_vk_composer.failed());
+    EXPECT_FALSE(aggregate_all_composer.failed());
+    EXPECT_EQ(aggregate_all_output.P0.x.get_value(), sequential_output.P0.x.get_value());
+    EXPECT_EQ(aggregate_all_output.P1.x.get_value(), sequential_output.P1.x.get_value());
+
+    // exactly the k sequential verifications with the vk made a witness once: the k - 1 vk witnesses are the whole
+    // difference from the k sequential calls
+    EXPECT_EQ(aggregate_all_composer.num_gates, shared_vk_composer.num_gates);
+    EXPECT_LT(aggregate_all_composer.num_gates, sequential_composer.num_gates);
+}
+
 TEST_F(play_tests, circuit_play_recursive_2_proof_gen)
 {
     Composer app_composer = Composer(barretenberg::srs::get_crs_factory());
@@ -10,7 +10,9 @@
 #include "aztec3/circuits/abis/previous_kernel_data.hpp"
 #include "aztec3/circuits/abis/public_data_read.hpp"
 #include "aztec3/circuits/hash.hpp"
+#include "aztec3/circuits/kernel/private/c_bind.h"
 #include "aztec3/circuits/kernel/private/utils.hpp"
+#include "aztec3/circuits/kernel_proof_verifier.hpp"
 #include "aztec3/circuits/rollup/components/components.hpp"
 #include "aztec3/circuits/rollup/test_utils/utils.hpp"
 #include "aztec3/constants.hpp"
@@ -19,17 +21,23 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <array>
 #include <cstddef>
 #include <cstdint>
 #include <iostream>
+#include <pthread.h>
 #include <tuple>
+#include <utility>
 #include <vector>
 
 
 namespace {
 
 
+using aztec3::circuits::verify_kernel_proofs;
 using aztec3::circuits::abis::PreviousKernelData;
+using aztec3::circuits::kernel::private_kernel::utils::dummy_previous_kernel;
 
 
 // using aztec3::circuits::mock::mock_circuit;
@@ -51,6 +59,46 @@ using aztec3::circuits::rollup::test_utils::utils::make_public_data_update_reque
 using aztec3::circuits::rollup::test_utils::utils::make_public_read;
 
 using DummyComposer = aztec3::utils::DummyComposer;
+
+// the stack the WASM build gets, see `-Wl,-z,stack-size` in src/aztec3/CMakeLists.txt
+constexpr size_t WASM_STACK_SIZE = 1048576;
+
+/**
+ * @brief Runs `fn` to completion on a thread whose stack is `stack_size` bytes, so a stack overflow in it crashes the
+ * test rather than passing unnoticed on the (much larger) main thread stack
+ */
+template <typename Fn> void run_with_stack_size(size_t stack_size, Fn& fn)
+{
+    pthread_attr_t attr;
+    pthread_attr_init(&attr);
+    pthread_attr_setstacksize(&attr, stack_size);
+
+    pthread_t thread;
+    auto run = [](void* arg) -> void* {
+        (*static_cast<Fn*>(arg))();
+        return nullptr;
+    };
+    ASSERT_EQ(pthread_create(&thread, &attr, run, &fn), 0);
+    pthread_join(thread, nullptr);
+    pthread_attr_destroy(&attr);
+}
+
+/**
+ * @brief Turns native kernel proof verification on for its lifetime, and off again however the test leaves its scope
+ */
+class ScopedKernelProofVerification {
+  public:
+    ScopedKernelProofVerification()
+    {
+        aztec3::circuits::rollup::native_base_rollup::set_kernel_proof_verification_enabled(true);
+    }
+    ~ScopedKernelProofVerification()
+    {
+        aztec3::circuits::rollup::native_base_rollup::set_kernel_proof_verification_enabled(false);
+    }
+    ScopedKernelProofVerification(ScopedKernelProofVerification const&) = delete;
+    ScopedKernelProofVerification& operator=(ScopedKernelProofVerification const&) = delete;
+};
 }  // namespace
 
 namespace aztec3::circuits::rollup::base::native_base_rollup_circuit {
@@ -523,6 +571,100 @@ TEST_F(base_rollup_tests, native_new_nullifier_tree_double_spend)
     ASSERT_EQ(composer.get_first_failure().message, "Nullifier is not in the correct range");
 }
 
+TEST_F(base_rollup_tests, native_fail_fast_keeps_first_failure_and_skips_later_stages)
+{
+    BaseRollupInputs const empty_inputs = base_rollup_inputs_from_kernels({ get_empty_kernel(), get_empty_kernel() });
+
+    std::array<fr, KERNEL_NEW_NULLIFIERS_LENGTH* 2> const new_nullifiers = { 11, 0, 11, 0, 0, 0, 0, 0 };
+    std::tuple<BaseRollupInputs, AppendOnlyTreeSnapshot<NT>, AppendOnlyTreeSnapshot<NT>> inputs_and_snapshots =
+        test_utils::utils::generate_nullifier_tree_testing_values(empty_inputs, new_nullifiers, 1);
+    BaseRollupInputs const testing_inputs = std::get<0>(inputs_and_snapshots);
+
+    DummyComposer composer = DummyComposer("base_rollup_tests__native_fail_fast_full_run");
+    aztec3::circuits::rollup::native_base_rollup::base_rollup_circuit(composer, testing_inputs);
+
+    DummyComposer fail_fast_composer = DummyComposer("base_rollup_tests__native_fail_fast", true);
+    BaseOrMergeRollupPublicInputs const fail_fast_outputs =
+        aztec3::circuits::rollup::native_base_rollup::base_rollup_circuit(fail_fast_composer, testing_inputs);
+
+    ASSERT_TRUE(fail_fast_composer.failed());
+    EXPECT_EQ(fail_fast_composer.get_first_failure().code, composer.get_first_failure().code);
+    EXPECT_EQ(fail_fast_composer.get_first_failure().message, composer.get_first_failure().message);
+    EXPECT_LE(fail_fast_composer.failure_msgs.size(), composer.failure_msgs.size());
+    // the stages after the nullifier insertion (e.g. the calldata hash) never ran
+    EXPECT_EQ(fail_fast_outputs.calldata_hash, (std::array<NT::fr, 2>{ 0, 0 }));
+}
+
+TEST_F(base_rollup_tests, native_fail_fast_matches_full_run_on_success)
+{
+    BaseRollupInputs const inputs = base_rollup_inputs_from_kernels({ get_empty_kernel(), get_empty_kernel() });
+
+    DummyComposer composer = DummyComposer("base_rollup_tests__native_fail_fast_success_full_run");
+    BaseOrMergeRollupPublicInputs const outputs =
+        aztec3::circuits::rollup::native_base_rollup::base_rollup_circuit(composer, inputs);
+
+    DummyComposer fail_fast_composer = DummyComposer("base_rollup_tests__native_fail_fast_success", true);
+    BaseOrMergeRollupPublicInputs const fail_fast_outputs =
+        aztec3::circuits::rollup::native_base_rollup::base_rollup_circuit(fail_fast_composer, inputs);
+
+    ASSERT_FALSE(composer.failed());
+    ASSERT_FALSE(fail_fast_composer.failed());
+    EXPECT_EQ(fail_fast_outputs, outputs);
+}
+
+TEST_F(base_rollup_tests, native_fail_fast_through_sim_cbind)
+{
+    BaseRollupInputs const inputs = base_rollup_inputs_from_kernels({ get_empty_kernel(), get_empty_kernel() });
+
+    std::array<fr, KERNEL_NEW_NULLIFIERS_LENGTH* 2> const new_nullifiers = { 11, 0, 11, 0, 0, 0, 0, 0 };
+    BaseRollupInputs const failing_inputs =
+        std::get<0>(test_utils::utils::generate_nullifier_tree_testing_values(inputs, new_nullifiers, 1));
+
+    for (auto const& item : { inputs, failing_inputs }) {
+        std::vector<uint8_t> inputs_vec;
+        write(inputs_vec, item);
+
+        uint8_t const* public_inputs_buf = nullptr;
+        size_t public_inputs_size = 0;
+        uint8_t* const circuit_failure_ptr =
+            base_rollup__sim(inputs_vec.data(), &public_inputs_size, &public_inputs_buf);
+
+        uint8_t const* fail_fast_public_inputs_buf = nullptr;
+        size_t fail_fast_public_inputs_size = 0;
+        uint8_t* const fail_fast_circuit_failure_ptr =
+            base_rollup__sim_fail_fast(inputs_vec.data(), &fail_fast_public_inputs_size, &fail_fast_public_inputs_buf);
+
+        BaseOrMergeRollupPublicInputs public_inputs;
+        BaseOrMergeRollupPublicInputs fail_fast_public_inputs;
+        uint8_t const* public_inputs_it = public_inputs_buf;
+        uint8_t const* fail_fast_public_inputs_it = fail_fast_public_inputs_buf;
+        read(public_inputs_it, public_inputs);
+        read(fail_fast_public_inputs_it, fail_fast_public_inputs);
+
+        ASSERT_EQ(fail_fast_circuit_failure_ptr == nullptr, circuit_failure_ptr == nullptr);
+        if (circuit_failure_ptr == nullptr) {
+            EXPECT_EQ(fail_fast_public_inputs, public_inputs);
+        } else {
+            aztec3::utils::CircuitError failure;
+            aztec3::utils::CircuitError fail_fast_failure;
+            uint8_t const* failure_it = circuit_failure_ptr;
+            uint8_t const* fail_fast_failure_it = fail_fast_circuit_failure_ptr;
+            read(failure_it, failure);
+            read(fail_fast_failure_it, fail_fast_failure);
+            EXPECT_EQ(fail_fast_failure.code, failure.code);
+            EXPECT_EQ(fail_fast_failure.message, failure.message);
+            // the stages after the nullifier insertion (e.g. the calldata hash) only ran in the full simulation
+            EXPECT_NE(public_inputs.calldata_hash, (std::array<NT::fr, 2>{ 0, 0 }));
+            EXPECT_EQ(fail_fast_public_inputs.calldata_hash, (std::array<NT::fr, 2>{ 0, 0 }));
+        }
+
+        free((void*)public_inputs_buf);
+        free((void*)circuit_failure_ptr);
+        free((void*)fail_fast_public_inputs_buf);
+        free((void*)fail_fast_circuit_failure_ptr);
+    }
+}
+
 TEST_F(base_rollup_tests, native_empty_block_calldata_hash)
 {
     DummyComposer composer = DummyComposer("base_rollup_tests__native_empty_block_calldata_hash");
@@ -685,6 +827,182 @@ TEST_F(base_rollup_tests, native_cbind_0)
     run_cbind(inputs, ignored_public_inputs, false);
 }
 
+TEST_F(base_rollup_tests, native_cbind_scratch_matches_cbind)
+{
+    BaseRollupInputs const inputs = base_rollup_inputs_from_kernels({ get_empty_kernel(), get_empty_kernel() });
+
+    std::array<fr, KERNEL_NEW_NULLIFIERS_LENGTH* 2> const new_nullifiers = { 11, 0, 11, 0, 0, 0, 0, 0 };
+    BaseRollupInputs const failing_inputs =
+        std::get<0>(test_utils::utils::generate_nullifier_tree_testing_values(inputs, new_nullifiers, 1));
+
+    for (auto const& item : { inputs, failing_inputs }) {
+        std::vector<uint8_t> inputs_vec;
+        write(inputs_vec, item);
+
+        uint8_t const* public_inputs_buf = nullptr;
+        size_t public_inputs_size = 0;
+        uint8_t* const circuit_failure_ptr =
+            base_rollup__sim(inputs_vec.data(), &public_inputs_size, &public_inputs_buf);
+
+        uint8_t const* scratch_public_inputs_buf = nullptr;
+        size_t scratch_public_inputs_size = 0;
+        uint8_t const* const scratch_circuit_failure_ptr =
+            base_rollup__sim_scratch(inputs_vec.data(), &scratch_public_inputs_size, &scratch_public_inputs_buf);
+
+        ASSERT_EQ(scratch_public_inputs_size, public_inputs_size);
+        EXPECT_TRUE(std::equal(public_inputs_buf, public_inputs_buf + public_inputs_size, scratch_public_inputs_buf));
+
+        ASSERT_EQ(scratch_circuit_failure_ptr == nullptr, circuit_failure_ptr == nullptr);
+        if (circuit_failure_ptr != nullptr) {
+            aztec3::utils::CircuitError failure;
+            aztec3::utils::CircuitError scratch_failure;
+            uint8_t const* failure_it = circuit_failure_ptr;
+            uint8_t const* scratch_failure_it = scratch_circuit_failure_ptr;
+            read(failure_it, failure);
+            read(scratch_failure_it, scratch_failure);
+            EXPECT_EQ(scratch_failure.code, failure.code);
+            EXPECT_EQ(scratch_failure.message, failure.message);
+        }
+
+        free((void*)public_inputs_buf);
+        free((void*)circuit_failure_ptr);
+    }
+
+    // a repeated call writes its outputs in place, over the previous call's
+    std::vector<uint8_t> inputs_vec;
+    write(inputs_vec, inputs);
+    uint8_t const* first_buf = nullptr;
+    uint8_t const* second_buf = nullptr;
+    size_t size = 0;
+    base_rollup__sim_scratch(inputs_vec.data(), &size, &first_buf);
+    base_rollup__sim_scratch(inputs_vec.data(), &size, &second_buf);
+    EXPECT_EQ(second_buf, first_buf);
+
+    scratch_arena__release();
+}
+
+TEST_F(base_rollup_tests, native_cbind_sparse_matches_cbind)
+{
+    BaseRollupInputs const inputs = base_rollup_inputs_from_kernels({ get_empty_kernel(), get_empty_kernel() });
+
+    std::array<fr, KERNEL_NEW_NULLIFIERS_LENGTH* 2> const new_nullifiers = { 11, 0, 11, 0, 0, 0, 0, 0 };
+    BaseRollupInputs const failing_inputs =
+        std::get<0>(test_utils::utils::generate_nullifier_tree_testing_values(inputs, new_nullifiers, 1));
+
+    for (auto const& item : { inputs, failing_inputs }) {
+        std::vector<uint8_t> inputs_vec;
+        write(inputs_vec, item);
+        std::vector<uint8_t> sparse_inputs_vec;
+        write_sparse(sparse_inputs_vec, item);
+        EXPECT_LT(sparse_inputs_vec.size(), inputs_vec.size());
+
+        uint8_t const* public_inputs_buf = nullptr;
+        size_t public_inputs_size = 0;
+        uint8_t* const circuit_failure_ptr =
+            base_rollup__sim(inputs_vec.data(), &public_inputs_size, &public_inputs_buf);
+
+        uint8_t const* sparse_public_inputs_buf = nullptr;
+        size_t sparse_public_inputs_size = 0;
+        uint8_t* const sparse_circuit_failure_ptr =
+            base_rollup__sim_sparse(sparse_inputs_vec.data(), &sparse_public_inputs_size, &sparse_public_inputs_buf);
+
+        ASSERT_EQ(sparse_public_inputs_size, public_inputs_size);
+        EXPECT_TRUE(std::equal(public_inputs_buf, public_inputs_buf + public_inputs_size, sparse_public_inputs_buf));
+
+        ASSERT_EQ(sparse_circuit_failure_ptr == nullptr, circuit_failure_ptr == nullptr);
+        if (circuit_failure_ptr != nullptr) {
+            aztec3::utils::CircuitError failure;
+            aztec3::utils::CircuitError sparse_failure;
+            uint8_t const* failure_it = circuit_failure_ptr;
+            uint8_t const* sparse_failure_it = sparse_circuit_failure_ptr;
+            read(failure_it, failure);
+            read(sparse_failure_it, sparse_failure);
+            EXPECT_EQ(sparse_failure.code, failure.code);
+            EXPECT_EQ(sparse_failure.message, failure.message);
+        }
+
+        free((void*)public_inputs_buf);
+        free((void*)circuit_failure_ptr);
+        free((void*)sparse_public_inputs_buf);
+        free((void*)sparse_circuit_failure_ptr);
+    }
+}
+
+TEST_F(base_rollup_tests, native_sim_batch_cbind_matches_sequential_simulation)
+{
+    BaseRollupInputs const inputs = base_rollup_inputs_from_kernels({ get_empty_kernel(), get_empty_kernel() });
+
+    std::array<fr, KERNEL_NEW_NULLIFIERS_LENGTH* 2> const new_nullifiers = { 11, 0, 11, 0, 0, 0, 0, 0 };
+    BaseRollupInputs const failing_inputs =
+        std::get<0>(test_utils::utils::generate_nullifier_tree_testing_values(inputs, new_nullifiers, 1));
+    std::vector<BaseRollupInputs> const batch_inputs = { inputs, failing_inputs };
+
+    using serialize::read;
+    using serialize::write;
+
+    std::vector<uint8_t> batch_inputs_vec;
+    write(batch_inputs_vec, batch_inputs);
+    uint8_t const* public_inputs_buf = nullptr;
+    size_t public_inputs_size = 0;
+    uint8_t* const errors_buf =
+        base_rollup__sim_batch(batch_inputs_vec.data(), &public_inputs_size, &public_inputs_buf);
+
+    std::vector<BaseOrMergeRollupPublicInputs> public_inputs;
+    uint8_t const* public_inputs_it = public_inputs_buf;
+    read(public_inputs_it, public_inputs);
+    EXPECT_EQ(static_cast<size_t>(public_inputs_it - public_inputs_buf), public_inputs_size);
+    std::vector<aztec3::utils::CircuitError> errors;
+    uint8_t const* errors_it = errors_buf;
+    read(errors_it, errors);
+    ASSERT_EQ(public_inputs.size(), batch_inputs.size());
+    ASSERT_EQ(errors.size(), batch_inputs.size());
+
+    for (size_t i = 0; i < batch_inputs.size(); i++) {
+        DummyComposer composer =
+            DummyComposer("base_rollup_tests__native_sim_batch_cbind_matches_sequential_simulation");
+        auto const expected_public_inputs = native_base_rollup::base_rollup_circuit(composer, batch_inputs[i]);
+
+        EXPECT_EQ(composer.failed(), i == 1);
+        EXPECT_EQ(public_inputs[i], expected_public_inputs);
+        EXPECT_EQ(errors[i].code, composer.get_first_failure().code);
+        EXPECT_EQ(errors[i].message, composer.get_first_failure().message);
+    }
+
+    free((void*)public_inputs_buf);
+    free((void*)errors_buf);
+}
+
+TEST_F(base_rollup_tests, native_cbind_runs_within_wasm_stack)
+{
+    // the base rollup takes the largest inputs of all the circuits: two kernels' data and the sibling paths of every
+    // tree it inserts into, none of which should end up on the stack
+    BaseRollupInputs const inputs = base_rollup_inputs_from_kernels({ get_empty_kernel(), get_empty_kernel() });
+    std::vector<uint8_t> inputs_vec;
+    write(inputs_vec, inputs);
+
+    uint8_t const* public_inputs_buf = nullptr;
+    size_t public_inputs_size = 0;
+    uint8_t* circuit_failure_ptr = nullptr;
+    auto sim = [&]() {
+        // twice, the second time decoding into the inputs the first left behind
+        for (size_t i = 0; i < 2; i++) {
+            free((void*)public_inputs_buf);
+            free((void*)circuit_failure_ptr);
+            circuit_failure_ptr = base_rollup__sim(inputs_vec.data(), &public_inputs_size, &public_inputs_buf);
+        }
+    };
+    run_with_stack_size(WASM_STACK_SIZE, sim);
+
+    EXPECT_EQ(circuit_failure_ptr, nullptr);
+    BaseOrMergeRollupPublicInputs public_inputs;
+    uint8_t const* public_inputs_it = public_inputs_buf;
+    read(public_inputs_it, public_inputs);
+    DummyComposer composer = DummyComposer("base_rollup_tests__native_cbind_runs_within_wasm_stack");
+    EXPECT_EQ(public_inputs, native_base_rollup::base_rollup_circuit(composer, inputs));
+
+    free((void*)public_inputs_buf);
+}
+
 TEST_F(base_rollup_tests, native_single_public_state_read)
 {
     DummyComposer composer = DummyComposer("base_rollup_tests__native_single_public_state_read");
@@ -819,4 +1137,116 @@ TEST_F(base_rollup_tests, native_invalid_public_state_read)
     run_cbind(inputs, outputs, true, false);
 }
 
+TEST_F(base_rollup_tests, native_kernel_proof_verification)
+{
+    BaseRollupInputs padding_inputs = base_rollup_inputs_from_kernels({ get_empty_kernel(), get_empty_kernel() });
+    BaseRollupInputs proven_inputs =
+        base_rollup_inputs_from_kernels({ dummy_previous_kernel(true), dummy_previous_kernel(true) });
+    BaseRollupInputs tampered_inputs = proven_inputs;
+    tampered_inputs.kernel_data[1].proof.proof_data[100] ^= 1;
+    // a kernel with a padding kernel's zero proof, but which accumulates something, is not a padding kernel
+    BaseRollupInputs unproven_inputs = padding_inputs;
+    unproven_inputs.kernel_data[0].public_inputs.end.new_l2_to_l1_msgs[0] = 1;
+    // as is one whose aggregation object would put points into the rollup's
+    BaseRollupInputs unproven_aggregation_inputs = padding_inputs;
+    auto& aggregation_object = unproven_aggregation_inputs.kernel_data[0].public_inputs.end.aggregation_object;
+    aggregation_object.P0 = barretenberg::g1::affine_one;
+    aggregation_object.P1 = barretenberg::g1::affine_one;
+    aggregation_object.has_data = true;
+    ASSERT_TRUE(native_base_rollup::is_padding_kernel(padding_inputs.kernel_data[0]));
+    ASSERT_FALSE(native_base_rollup::is_padding_kernel(unproven_inputs.kernel_data[0]));
+    ASSERT_FALSE(native_base_rollup::is_padding_kernel(unproven_aggregation_inputs.kernel_data[0]));
+
+    // off by default, so placeholder kernel proofs are accepted
+    DummyComposer unverified_composer = DummyComposer("base_rollup_tests__native_kernel_proof_verification");
+    native_base_rollup::base_rollup_circuit(unverified_composer, padding_inputs);
+    EXPECT_FALSE(unverified_composer.failed());
+    DummyComposer unverified_unproven_composer =
+        DummyComposer("base_rollup_tests__native_kernel_proof_verification");
+    native_base_rollup::base_rollup_circuit(unverified_unproven_composer, unproven_inputs);
+    EXPECT_NE(unverified_unproven_composer.get_first_failure().code,
+              native_base_rollup::CircuitErrorCode::BASE__KERNEL_PROOF_VERIFICATION_FAILED);
+
+    ScopedKernelProofVerification const verification;
+
+    DummyComposer padding_composer = DummyComposer("base_rollup_tests__native_kernel_proof_verification");
+    native_base_rollup::base_rollup_circuit(padding_composer, padding_inputs);
+    EXPECT_FALSE(padding_composer.failed());
+
+    DummyComposer proven_composer = DummyComposer("base_rollup_tests__native_kernel_proof_verification");
+    native_base_rollup::base_rollup_circuit(proven_composer, proven_inputs);
+    EXPECT_FALSE(proven_composer.failed());
+
+    for (auto const& failing_inputs : { tampered_inputs, unproven_inputs, unproven_aggregation_inputs }) {
+        DummyComposer failing_composer = DummyComposer("base_rollup_tests__native_kernel_proof_verification");
+        native_base_rollup::base_rollup_circuit(failing_composer, failing_inputs);
+        EXPECT_TRUE(failing_composer.failed());
+        EXPECT_EQ(failing_composer.get_first_failure().code,
+                  native_base_rollup::CircuitErrorCode::BASE__KERNEL_PROOF_VERIFICATION_FAILED);
+    }
+}
+
+TEST_F(base_rollup_tests, native_kernel_proof_verification_through_sim_cbinds)
+{
+    BaseRollupInputs const proven_inputs =
+        base_rollup_inputs_from_kernels({ dummy_previous_kernel(true), get_empty_kernel() });
+    BaseRollupInputs tampered_inputs = proven_inputs;
+    tampered_inputs.kernel_data[0].proof.proof_data[100] ^= 1;
+
+    ScopedKernelProofVerification const verification;
+
+    for (auto const& [inputs, should_verify] :
+         std::array<std::pair<BaseRollupInputs, bool>, 2>{ { { proven_inputs, true }, { tampered_inputs, false } } }) {
+        std::vector<uint8_t> inputs_vec;
+        write(inputs_vec, inputs);
+
+        uint8_t const* public_inputs_buf = nullptr;
+        size_t public_inputs_size = 0;
+        uint8_t* const circuit_failure_ptr =
+            base_rollup__sim(inputs_vec.data(), &public_inputs_size, &public_inputs_buf);
+
+        uint8_t const* scratch_public_inputs_buf = nullptr;
+        size_t scratch_public_inputs_size = 0;
+        uint8_t const* const scratch_circuit_failure_ptr =
+            base_rollup__sim_scratch(inputs_vec.data(), &scratch_public_inputs_size, &scratch_public_inputs_buf);
+
+        auto const failure_ptrs = { static_cast<uint8_t const*>(circuit_failure_ptr), scratch_circuit_failure_ptr };
+        for (uint8_t const* failure_ptr : failure_ptrs) {
+            if (should_verify) {
+                EXPECT_EQ(failure_ptr, nullptr);
+            } else {
+                ASSERT_NE(failure_ptr, nullptr);
+                aztec3::utils::CircuitError failure;
+                read(failure_ptr, failure);
+                EXPECT_EQ(failure.code, native_base_rollup::CircuitErrorCode::BASE__KERNEL_PROOF_VERIFICATION_FAILED);
+            }
+        }
+
+        free((void*)public_inputs_buf);
+        free((void*)circuit_failure_ptr);
+    }
+}
+
+TEST_F(base_rollup_tests, native_kernel_proofs_verify_in_batch)
+{
+    std::vector<PreviousKernelData<NT>> kernel_data(3, dummy_previous_kernel(true));
+    EXPECT_TRUE(verify_kernel_proofs(kernel_data));
+    EXPECT_TRUE(verify_kernel_proofs({}));
+
+    std::vector<uint8_t> kernel_data_buf;
+    write(kernel_data_buf, kernel_data);
+    EXPECT_TRUE(base_rollup__verify_kernel_proofs(kernel_data_buf.data()));
+
+    // one bad proof fails the whole batch, whether it is the first or a later one
+    for (size_t const bad_index : std::array<size_t, 2>{ 0, 2 }) {
+        auto tampered = kernel_data;
+        tampered[bad_index].proof.proof_data[100] ^= 1;
+        EXPECT_FALSE(verify_kernel_proofs(tampered));
+    }
+
+    auto with_placeholder = kernel_data;
+    with_placeholder[1] = get_empty_kernel();
+    EXPECT_FALSE(verify_kernel_proofs(with_placeholder));
+}
+
 }  // namespace aztec3::circuits::rollup::base::native_base_rollup_circuit
@@ -3,9 +3,16 @@
 #include "index.hpp"
 #include "init.hpp"
 
+#include "aztec3/circuits/abis/previous_kernel_data.hpp"
 #include "aztec3/circuits/abis/rollup/base/base_or_merge_rollup_public_inputs.hpp"
+#include "aztec3/circuits/kernel_proof_verifier.hpp"
+#include "aztec3/circuits/mock/mock_kernel_proof.hpp"
 #include "aztec3/constants.hpp"
+#include "aztec3/utils/batch_simulation.hpp"
 #include "aztec3/utils/dummy_composer.hpp"
+#include "aztec3/utils/input_slot.hpp"
+#include "aztec3/utils/malloc_output.hpp"
+#include "aztec3/utils/scratch_arena.hpp"
 #include "aztec3/utils/types/native_types.hpp"
 
 #include <barretenberg/barretenberg.hpp>
@@ -16,13 +23,71 @@ using NT = aztec3::utils::types::NativeTypes;
 using DummyComposer = aztec3::utils::DummyComposer;
 using aztec3::circuits::abis::BaseOrMergeRollupPublicInputs;
 using aztec3::circuits::abis::BaseRollupInputs;
+using aztec3::circuits::abis::PreviousKernelData;
+using aztec3::circuits::abis::read_kernel_public_inputs_and_proofs;
+using aztec3::circuits::verify_kernel_proofs;
+using aztec3::circuits::mock::verify_mock_kernel_proofs;
 using aztec3::circuits::rollup::native_base_rollup::base_rollup_circuit;
+using aztec3::circuits::rollup::native_base_rollup::is_kernel_proof_verification_enabled;
+using aztec3::circuits::rollup::native_base_rollup::set_kernel_proof_verification_enabled;
+using aztec3::utils::get_input_slot;
+using aztec3::utils::serialize_to_malloc_buffer;
+using aztec3::utils::serialize_to_scratch_arena;
+using aztec3::utils::simulate_batch;
+using aztec3::utils::write_to_malloc_buffer;
+
+/**
+ * @brief Decodes the base rollup inputs into the calling thread's input slot (see `get_input_slot`)
+ * @details The kernels' vks are only decoded when their proofs are to be verified: otherwise the circuit never reads
+ * them, and `read_kernel_public_inputs_and_proofs` steps over them.
+ */
+BaseRollupInputs<NT> const& read_base_rollup_inputs(uint8_t const* base_rollup_inputs_buf)
+{
+    auto& base_rollup_inputs = get_input_slot<BaseRollupInputs<NT>>();
+    if (is_kernel_proof_verification_enabled()) {
+        read(base_rollup_inputs_buf, base_rollup_inputs);
+    } else {
+        read_kernel_public_inputs_and_proofs(base_rollup_inputs_buf, base_rollup_inputs);
+    }
+    return base_rollup_inputs;
+}
+
+/**
+ * @brief Simulates the base rollup on `composer`, returning what `base_rollup__sim` returns
+ */
+uint8_t* sim_base_rollup(DummyComposer& composer,
+                         uint8_t const* base_rollup_inputs_buf,
+                         size_t* base_rollup_public_inputs_size_out,
+                         uint8_t const** base_or_merge_rollup_public_inputs_buf)
+{
+    // TODO accept proving key and use that to initialize composers
+    // this info is just to prevent error for unused pk_buf
+    // TODO do we want to accept it or just get it from our factory?
+    // auto crs_factory = std::make_shared<EnvReferenceStringFactory>();
+
+    auto const& base_rollup_inputs = read_base_rollup_inputs(base_rollup_inputs_buf);
+
+    BaseOrMergeRollupPublicInputs<NT> const public_inputs = base_rollup_circuit(composer, base_rollup_inputs);
+
+    // TODO for circuit proof version of this function
+    // NT::Proof base_rollup_proof;
+    //    Composer composer = Composer(crs_factory);
+    //    auto prover = composer.create_prover();
+    //    public_inputs = base_rollup_circuit(composer, base_rollup_inputs);
+    //    base_rollup_proof = prover.construct_proof();
+
+    return serialize_to_malloc_buffer(
+        composer, public_inputs, base_rollup_public_inputs_size_out, base_or_merge_rollup_public_inputs_buf);
+}
 
 }  // namespace
 
 // WASM Cbinds
 extern "C" {
 
+// TODO: still a placeholder. The base rollup is only simulated natively, and has no circuit to compute a proving key
+// from yet. Once it does, its keys belong in the `ProvingKeyCache` (with a `ProvingKeyCircuit` tag of their own) and
+// are serialized from there, as `private_kernel__init_proving_key` does.
 WASM_EXPORT size_t base_rollup__init_proving_key(uint8_t const** pk_buf)
 {
     std::vector<uint8_t> pk_vec(42, 0);
@@ -52,32 +117,82 @@ WASM_EXPORT uint8_t* base_rollup__sim(uint8_t const* base_rollup_inputs_buf,
                                       uint8_t const** base_or_merge_rollup_public_inputs_buf)
 {
     DummyComposer composer = DummyComposer("base_rollup__sim");
-    // TODO accept proving key and use that to initialize composers
-    // this info is just to prevent error for unused pk_buf
-    // TODO do we want to accept it or just get it from our factory?
-    // auto crs_factory = std::make_shared<EnvReferenceStringFactory>();
+    return sim_base_rollup(
+        composer, base_rollup_inputs_buf, base_rollup_public_inputs_size_out, base_or_merge_rollup_public_inputs_buf);
+}
 
-    BaseRollupInputs<NT> base_rollup_inputs;
-    read(base_rollup_inputs_buf, base_rollup_inputs);
+/**
+ * @brief As `base_rollup__sim`, but in fail-fast mode (see `DummyComposer::should_stop`): an invalid block stops at
+ * its first failure, which is the one returned, and the outputs of the stages it skips are left empty
+ */
+WASM_EXPORT uint8_t* base_rollup__sim_fail_fast(uint8_t const* base_rollup_inputs_buf,
+                                                size_t* base_rollup_public_inputs_size_out,
+                                                uint8_t const** base_or_merge_rollup_public_inputs_buf)
+{
+    DummyComposer composer = DummyComposer("base_rollup__sim_fail_fast", true);
+    return sim_base_rollup(
+        composer, base_rollup_inputs_buf, base_rollup_public_inputs_size_out, base_or_merge_rollup_public_inputs_buf);
+}
+
+/**
+ * @brief As `base_rollup__sim`, with the kernels' public inputs in the sparse encoding of `write_sparse`
+ * @details The public inputs returned are as `base_rollup__sim` returns them: they have no long runs of empty items
+ * to save. The kernels' vks are always decoded, as the sparse encoding leaves no fixed layout to step over them with.
+ */
+WASM_EXPORT uint8_t* base_rollup__sim_sparse(uint8_t const* base_rollup_inputs_buf,
+                                             size_t* base_rollup_public_inputs_size_out,
+                                             uint8_t const** base_or_merge_rollup_public_inputs_buf)
+{
+    DummyComposer composer = DummyComposer("base_rollup__sim_sparse");
+
+    auto& base_rollup_inputs = get_input_slot<BaseRollupInputs<NT>>();
+    read_sparse(base_rollup_inputs_buf, base_rollup_inputs);
 
     BaseOrMergeRollupPublicInputs<NT> const public_inputs = base_rollup_circuit(composer, base_rollup_inputs);
 
-    // TODO for circuit proof version of this function
-    // NT::Proof base_rollup_proof;
-    //    Composer composer = Composer(crs_factory);
-    //    auto prover = composer.create_prover();
-    //    public_inputs = base_rollup_circuit(composer, base_rollup_inputs);
-    //    base_rollup_proof = prover.construct_proof();
+    return serialize_to_malloc_buffer(
+        composer, public_inputs, base_rollup_public_inputs_size_out, base_or_merge_rollup_public_inputs_buf);
+}
+
+/**
+ * @brief As `base_rollup__sim`, but the public inputs and the failure (if any) are serialized straight into the
+ * calling thread's scratch arena
+ * @details The returned pointers stay valid until the next `*_scratch` call on this thread or
+ * `scratch_arena__release`, and must not be freed.
+ */
+WASM_EXPORT uint8_t const* base_rollup__sim_scratch(uint8_t const* base_rollup_inputs_buf,
+                                                    size_t* base_rollup_public_inputs_size_out,
+                                                    uint8_t const** base_or_merge_rollup_public_inputs_buf)
+{
+    DummyComposer composer = DummyComposer("base_rollup__sim_scratch");
+
+    auto const& base_rollup_inputs = read_base_rollup_inputs(base_rollup_inputs_buf);
+
+    BaseOrMergeRollupPublicInputs<NT> const public_inputs = base_rollup_circuit(composer, base_rollup_inputs);
+
+    return serialize_to_scratch_arena(
+        composer, public_inputs, base_rollup_public_inputs_size_out, base_or_merge_rollup_public_inputs_buf);
+}
+
+/**
+ * @brief Simulates the base rollup circuit over many independent inputs at once
+ * @details Takes a length-prefixed vector of BaseRollupInputs and writes a length-prefixed vector of public inputs.
+ * The items run concurrently when multithreading is enabled.
+ * @return a length-prefixed vector of CircuitErrors with one entry per input (NO_ERROR on success), in input order
+ */
+WASM_EXPORT uint8_t* base_rollup__sim_batch(uint8_t const* base_rollup_inputs_buf,
+                                            size_t* base_rollup_public_inputs_size_out,
+                                            uint8_t const** base_or_merge_rollup_public_inputs_buf)
+{
+    std::vector<BaseRollupInputs<NT>> base_rollup_inputs;
+    read(base_rollup_inputs_buf, base_rollup_inputs);
+
+    auto const batch_result = simulate_batch("base_rollup__sim_batch", base_rollup_inputs, base_rollup_circuit);
 
-    // serialize public inputs to bytes vec
-    std::vector<uint8_t> public_inputs_vec;
-    write(public_inputs_vec, public_inputs);
-    // copy public inputs to output buffer
-    auto* raw_public_inputs_buf = (uint8_t*)malloc(public_inputs_vec.size());
-    memcpy(raw_public_inputs_buf, (void*)public_inputs_vec.data(), public_inputs_vec.size());
-    *base_or_merge_rollup_public_inputs_buf = raw_public_inputs_buf;
-    *base_rollup_public_inputs_size_out = public_inputs_vec.size();
-    return composer.alloc_and_serialize_first_failure();
+    *base_or_merge_rollup_public_inputs_buf =
+        write_to_malloc_buffer(batch_result.outputs, base_rollup_public_inputs_size_out);
+    size_t circuit_failures_size = 0;
+    return write_to_malloc_buffer(batch_result.errors, &circuit_failures_size);
 }
 
 // WASM_EXPORT size_t base_rollup__sim(uint8_t const* base_rollup_inputs_buf,
@@ -132,4 +247,37 @@ WASM_EXPORT uint8_t* base_rollup__sim(uint8_t const* base_rollup_inputs_buf,
 //     return true;
 // }
 
-}  // extern "C"
\ No newline at end of file
+}  // extern "C"
+
+/**
+ * @brief Opts in to (or out of) verifying the kernel proofs of every later base rollup natively, failing the rollup
+ * with BASE__KERNEL_PROOF_VERIFICATION_FAILED if either does not verify
+ */
+CBIND(base_rollup__set_kernel_proof_verification_enabled, [](bool enabled) {
+    set_kernel_proof_verification_enabled(enabled);
+    return is_kernel_proof_verification_enabled();
+});
+
+/**
+ * @brief Verifies several kernel proofs natively and in parallel, each with its own pairing check, e.g. every kernel
+ * proof received before any is rolled up
+ * @param kernel_data_buf a length-prefixed vector of serialized `PreviousKernelData`s, each with its proof and vk
+ * @return whether every proof verifies against the vk it comes with
+ */
+WASM_EXPORT bool base_rollup__verify_kernel_proofs(uint8_t const* kernel_data_buf)
+{
+    std::vector<PreviousKernelData<NT>> kernel_data;
+    read(kernel_data_buf, kernel_data);
+    return verify_kernel_proofs(kernel_data);
+}
+
+/**
+ * @brief As `base_rollup__verify_kernel_proofs`, for kernels proven with `private_kernel__prove_mock`
+ * @return whether every proof is the mock proof of its kernel's public inputs
+ */
+WASM_EXPORT bool base_rollup__verify_mock_kernel_proofs(uint8_t const* kernel_data_buf)
+{
+    std::vector<PreviousKernelData<NT>> kernel_data;
+    read(kernel_data_buf, kernel_data);
+    return verify_mock_kernel_proofs(kernel_data);
+}
@@ -13,5 +13,21 @@ WASM_EXPORT size_t base_rollup__dummy_previous_rollup(uint8_t const** previous_r
 WASM_EXPORT uint8_t* base_rollup__sim(uint8_t const* base_rollup_inputs_buf,
                                       size_t* base_rollup_public_inputs_size_out,
                                       uint8_t const** base_or_merge_rollup_public_inputs_buf);
+WASM_EXPORT uint8_t* base_rollup__sim_fail_fast(uint8_t const* base_rollup_inputs_buf,
+                                                size_t* base_rollup_public_inputs_size_out,
+                                                uint8_t const** base_or_merge_rollup_public_inputs_buf);
+WASM_EXPORT uint8_t* base_rollup__sim_sparse(uint8_t const* base_rollup_inputs_buf,
+                                             size_t* base_rollup_public_inputs_size_out,
+                                             uint8_t const** base_or_merge_rollup_public_inputs_buf);
+WASM_EXPORT uint8_t const* base_rollup__sim_scratch(uint8_t const* base_rollup_inputs_buf,
+                                                    size_t* base_rollup_public_inputs_size_out,
+                                                    uint8_t const** base_or_merge_rollup_public_inputs_buf);
+WASM_EXPORT uint8_t* base_rollup__sim_batch(uint8_t const* base_rollup_inputs_buf,
+                                            size_t* base_rollup_public_inputs_size_out,
+                                            uint8_t const** base_or_merge_rollup_public_inputs_buf);
 WASM_EXPORT size_t base_rollup__verify_proof(uint8_t const* vk_buf, uint8_t const* proof, uint32_t length);
-}
\ No newline at end of file
+}
+
+CBIND_DECL(base_rollup__set_kernel_proof_verification_enabled);
+WASM_EXPORT bool base_rollup__verify_kernel_proofs(uint8_t const* kernel_data_buf);
+WASM_EXPORT bool base_rollup__verify_mock_kernel_proofs(uint8_t const* kernel_data_buf);
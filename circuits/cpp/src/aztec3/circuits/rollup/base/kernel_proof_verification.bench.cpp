@@ -0,0 +1,56 @@
+#include "aztec3/circuits/abis/previous_kernel_data.hpp"
+#include "aztec3/circuits/kernel/private/utils.hpp"
+#include "aztec3/circuits/kernel_proof_verifier.hpp"
+#include "aztec3/utils/types/native_types.hpp"
+
+#include <barretenberg/barretenberg.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+namespace {
+
+using aztec3::circuits::verify_kernel_proof;
+using aztec3::circuits::verify_kernel_proofs;
+using aztec3::circuits::abis::PreviousKernelData;
+using aztec3::circuits::kernel::private_kernel::utils::dummy_previous_kernel;
+using NT = aztec3::utils::types::NativeTypes;
+
+std::vector<PreviousKernelData<NT>> proven_kernels(size_t num_kernels)
+{
+    barretenberg::srs::init_crs_factory("../barretenberg/cpp/srs_db/ignition");
+    return std::vector<PreviousKernelData<NT>>(num_kernels, dummy_previous_kernel(true));
+}
+
+/**
+ * @brief Verifies `state.range(0)` kernel proofs one at a time, as a caller of `private_kernel__verify_proof` would
+ */
+void verify_kernel_proofs_one_at_a_time(benchmark::State& state)
+{
+    auto const kernel_data = proven_kernels(static_cast<size_t>(state.range(0)));
+    for (auto _ : state) {
+        bool all_verified = true;
+        for (auto const& kernel : kernel_data) {
+            all_verified = all_verified && verify_kernel_proof(kernel.vk, kernel.proof);
+        }
+        benchmark::DoNotOptimize(all_verified);
+    }
+}
+BENCHMARK(verify_kernel_proofs_one_at_a_time)->Arg(2)->Arg(8)->Arg(32)->Unit(benchmark::kMillisecond);
+
+/**
+ * @brief Verifies the same kernel proofs with `verify_kernel_proofs`, one pairing check per proof, spread over threads
+ */
+void verify_kernel_proofs_in_parallel(benchmark::State& state)
+{
+    auto const kernel_data = proven_kernels(static_cast<size_t>(state.range(0)));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(verify_kernel_proofs(kernel_data));
+    }
+}
+BENCHMARK(verify_kernel_proofs_in_parallel)->Arg(2)->Arg(8)->Arg(32)->Unit(benchmark::kMillisecond);
+
+}  // namespace
+
+BENCHMARK_MAIN();
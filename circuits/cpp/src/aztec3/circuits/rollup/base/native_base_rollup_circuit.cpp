@@ -6,6 +6,7 @@
 #include "aztec3/circuits/abis/rollup/base/base_or_merge_rollup_public_inputs.hpp"
 #include "aztec3/circuits/abis/rollup/base/base_rollup_inputs.hpp"
 #include "aztec3/circuits/hash.hpp"
+#include "aztec3/circuits/kernel_proof_verifier.hpp"
 #include "aztec3/circuits/rollup/components/components.hpp"
 #include "aztec3/constants.hpp"
 #include "aztec3/utils/circuit_errors.hpp"
@@ -14,11 +15,19 @@
 
 #include <algorithm>
 #include <array>
+#include <atomic>
 #include <cstdint>
 #include <iostream>
+#include <iterator>
 #include <tuple>
 #include <vector>
 
+namespace {
+
+// opt-in: the kernel proofs of simulated (and test) rollups are usually placeholders which do not verify
+std::atomic<bool> kernel_proof_verification_enabled = false;
+
+}  // namespace
 
 namespace aztec3::circuits::rollup::native_base_rollup {
 
@@ -28,27 +37,57 @@ NT::fr calculate_empty_tree_root(const size_t depth)
     return empty_tree.root();
 }
 
-// TODO: can we aggregate proofs if we do not have a working circuit impl
+/**
+ * @brief Turns the native verification of the base rollup's kernel proofs on or off (it is off by default)
+ */
+void set_kernel_proof_verification_enabled(bool enabled)
+{
+    kernel_proof_verification_enabled = enabled;
+}
 
-bool verify_kernel_proof(NT::Proof const& kernel_proof)
+bool is_kernel_proof_verification_enabled()
+{
+    return kernel_proof_verification_enabled;
+}
+
+/**
+ * @brief Whether a kernel is one the sequencer pads a block with: no proof (all zero bytes), nothing accumulated, and
+ * an aggregation object without data
+ *
+ * @details Such a kernel adds no commitments, nullifiers, contracts, messages, logs or public data to the rollup, and
+ * nothing to its aggregation object (`accumulate_aggregation_objects` leaves out objects without data), so there is
+ * nothing its proof could vouch for, and its proof is not verified. A kernel accumulating anything at all, including
+ * points for the root to pairing-check, has its proof verified, whatever it looks like.
+ */
+bool is_padding_kernel(abis::PreviousKernelData<NT> const& kernel_data)
 {
-    (void)kernel_proof;
-    return true;
+    auto const& proof_data = kernel_data.proof.proof_data;
+    if (!std::all_of(proof_data.begin(), proof_data.end(), [](uint8_t byte) { return byte == 0; })) {
+        return false;
+    }
+    auto const& aggregation_object = kernel_data.public_inputs.end.aggregation_object;
+    if (aggregation_object.has_data) {
+        return false;
+    }
+    abis::CombinedAccumulatedData<NT> nothing_accumulated;
+    nothing_accumulated.aggregation_object = aggregation_object;
+    return kernel_data.public_inputs.end == nothing_accumulated;
 }
 
+// TODO: can we aggregate proofs if we do not have a working circuit impl
+
 /**
- * @brief Create an aggregation object for the proofs that are provided
- *          - We add points P0 for each of our proofs
- *          - We add points P1 for each of our proofs
- *          - We concat our public inputs
+ * @brief Create an aggregation object for the proofs that are provided, by folding the kernels' aggregation objects
+ * (see `components::accumulate_aggregation_objects`)
  *
  * @param baseRollupInputs
  * @return AggregationObject
  */
 AggregationObject aggregate_proofs(BaseRollupInputs const& baseRollupInputs)
 {
-    // TODO: NOTE: for now we simply return the aggregation object from the first proof
-    return baseRollupInputs.kernel_data[0].public_inputs.end.aggregation_object;
+    return components::accumulate_aggregation_objects(
+        { baseRollupInputs.kernel_data[0].public_inputs.end.aggregation_object,
+          baseRollupInputs.kernel_data[1].public_inputs.end.aggregation_object });
 }
 
 /** TODO: implement
@@ -141,7 +180,7 @@ void perform_historical_private_data_tree_membership_checks(DummyComposer& compo
                              historic_root_witness.leaf_index,
                              historic_root_witness.sibling_path,
                              historic_root,
-                             format("historic private data tree roots ", i));
+                             [&]() { return format("historic private data tree roots ", i); });
     }
 }
 
@@ -162,7 +201,7 @@ void perform_historical_contract_data_tree_membership_checks(DummyComposer& comp
                              historic_root_witness.leaf_index,
                              historic_root_witness.sibling_path,
                              historic_root,
-                             format("historic contract data tree roots ", i));
+                             [&]() { return format("historic contract data tree roots ", i); });
     }
 }
 
@@ -183,7 +222,7 @@ void perform_historical_l1_to_l2_message_tree_membership_checks(DummyComposer& c
                              historic_root_witness.leaf_index,
                              historic_root_witness.sibling_path,
                              historic_root,
-                             format("historic l1 to l2 data tree roots ", i));
+                             [&]() { return format("historic l1 to l2 data tree roots ", i); });
     }
 }
 
@@ -387,7 +426,7 @@ fr insert_public_data_update_requests(
                              state_write.leaf_index,
                              witness,
                              root,
-                             format("validate_public_data_update_requests index ", i));
+                             [&]() { return format("validate_public_data_update_requests index ", i); });
 
         root = root_from_sibling_path<NT>(state_write.new_value, state_write.leaf_index, witness);
     }
@@ -415,7 +454,7 @@ void validate_public_data_reads(
                              public_data_read.leaf_index,
                              witness,
                              tree_root,
-                             format("validate_public_data_reads index ", i + witnesses_offset));
+                             [&]() { return format("validate_public_data_reads index ", i + witnesses_offset); });
     }
 };
 
@@ -456,11 +495,20 @@ fr validate_and_process_public_state(DummyComposer& composer, BaseRollupInputs c
 BaseOrMergeRollupPublicInputs base_rollup_circuit(DummyComposer& composer, BaseRollupInputs const& baseRollupInputs)
 {
     // Verify the previous kernel proofs
-    for (size_t i = 0; i < 2; i++) {
-        NT::Proof const proof = baseRollupInputs.kernel_data[i].proof;
-        composer.do_assert(verify_kernel_proof(proof),
-                           "kernel proof verification failed",
-                           CircuitErrorCode::BASE__KERNEL_PROOF_VERIFICATION_FAILED);
+    if (is_kernel_proof_verification_enabled()) {
+        std::vector<abis::PreviousKernelData<NT>> proven_kernels;
+        std::copy_if(baseRollupInputs.kernel_data.begin(),
+                     baseRollupInputs.kernel_data.end(),
+                     std::back_inserter(proven_kernels),
+                     [](auto const& kernel_data) { return !is_padding_kernel(kernel_data); });
+        composer.do_assert(
+            verify_kernel_proofs(proven_kernels),
+            "kernel proof verification failed",
+            CircuitErrorCode::BASE__KERNEL_PROOF_VERIFICATION_FAILED);
+    }
+
+    if (composer.should_stop()) {
+        return {};
     }
 
     // First we compute the contract tree leaves
@@ -492,13 +540,25 @@ BaseOrMergeRollupPublicInputs base_rollup_circuit(DummyComposer& composer, BaseR
                                                     CONTRACT_SUBTREE_DEPTH,
                                                     "empty contract subtree membership check");
 
+    if (composer.should_stop()) {
+        return {};
+    }
+
     // Insert nullifiers:
     AppendOnlySnapshot const end_nullifier_tree_snapshot =
         check_nullifier_tree_non_membership_and_insert_to_tree(composer, baseRollupInputs);
 
+    if (composer.should_stop()) {
+        return {};
+    }
+
     // Validate public public data reads and public data update requests, and update public data tree
     fr const end_public_data_tree_root = validate_and_process_public_state(composer, baseRollupInputs);
 
+    if (composer.should_stop()) {
+        return {};
+    }
+
     // Calculate the overall calldata hash
     std::array<NT::fr, 2> const calldata_hash = components::compute_kernels_calldata_hash(baseRollupInputs.kernel_data);
 
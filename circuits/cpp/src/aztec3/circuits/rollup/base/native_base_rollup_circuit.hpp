@@ -12,6 +12,12 @@
 
 namespace aztec3::circuits::rollup::native_base_rollup {
 
+void set_kernel_proof_verification_enabled(bool enabled);
+
+bool is_kernel_proof_verification_enabled();
+
+bool is_padding_kernel(abis::PreviousKernelData<NT> const& kernel_data);
+
 BaseOrMergeRollupPublicInputs base_rollup_circuit(DummyComposer& composer, BaseRollupInputs const& baseRollupInputs);
 
 }  // namespace aztec3::circuits::rollup::native_base_rollup
\ No newline at end of file
@@ -3,6 +3,8 @@
 #include "aztec3/circuits/abis/rollup/base/base_or_merge_rollup_public_inputs.hpp"
 #include "aztec3/constants.hpp"
 #include "aztec3/utils/circuit_errors.hpp"
+#include "aztec3/utils/crs_factory.hpp"
+#include "aztec3/utils/field_serialization.hpp"
 
 #include <barretenberg/barretenberg.hpp>
 
@@ -15,6 +17,8 @@
 
 namespace aztec3::circuits::rollup::components {
 
+using aztec3::utils::field_array_to_bytes;
+
 /**
  * @brief Get the root of an empty tree of a given depth
  *
@@ -28,20 +32,87 @@ NT::fr calculate_empty_tree_root(const size_t depth)
 }
 
 /**
- * @brief Create an aggregation object for the proofs that are provided
- *          - We add points P0 for each of our proofs
- *          - We add points P1 for each of our proofs
- *          - We concat our public inputs
+ * @brief Folds aggregation objects into one, whose pairing check passes only if (with overwhelming probability) every
+ * one of theirs does
+ *
+ * @details An aggregation object defers the pairing check e(P0, [1]) * e(P1, [x]) == 1 of the proofs it has absorbed.
+ * The check is linear in P0 and P1, so the objects' checks all hold if the check of their random linear combination
+ * does: P0 = sum_i r^i * P0_i, and likewise for P1. The challenge r is a hash of every point folded, so that no object
+ * can be chosen to cancel out another's failure. This lets every rollup but the root defer its proofs' pairings, with
+ * one pairing check for the whole tree at the root.
  *
- * @param mergeRollupInputs
+ * Objects without data (e.g. of proofs which verified nothing recursively) are left out. If no object has data, the
+ * first is returned as it is.
+ *
+ * @param aggregation_objects the objects to fold, in order
  * @return AggregationObject
  */
+AggregationObject accumulate_aggregation_objects(std::vector<AggregationObject> const& aggregation_objects)
+{
+    std::vector<AggregationObject const*> with_data;
+    for (auto const& aggregation_object : aggregation_objects) {
+        if (aggregation_object.has_data) {
+            with_data.push_back(&aggregation_object);
+        }
+    }
+    if (with_data.empty()) {
+        return aggregation_objects.empty() ? AggregationObject{} : aggregation_objects[0];
+    }
+    if (with_data.size() == 1) {
+        return *with_data[0];
+    }
+
+    std::vector<uint8_t> transcript;
+    for (auto const* aggregation_object : with_data) {
+        write(transcript, aggregation_object->P0.x);
+        write(transcript, aggregation_object->P0.y);
+        write(transcript, aggregation_object->P1.x);
+        write(transcript, aggregation_object->P1.y);
+    }
+    auto challenge_bytes = blake2::blake2s(transcript);
+    // clear the top byte, so that the challenge is below the modulus
+    challenge_bytes[0] = 0;
+    NT::fr const challenge = NT::fr::serialize_from_buffer(challenge_bytes.data());
+
+    // sum_i r^i * P_i by Horner's rule, from the last object back to the first
+    barretenberg::g1::element P0(with_data.back()->P0);
+    barretenberg::g1::element P1(with_data.back()->P1);
+    for (size_t i = with_data.size() - 1; i-- > 0;) {
+        P0 = P0 * challenge + with_data[i]->P0;
+        P1 = P1 * challenge + with_data[i]->P1;
+    }
+
+    AggregationObject accumulated = *with_data[0];
+    accumulated.P0 = barretenberg::g1::affine_element(P0);
+    accumulated.P1 = barretenberg::g1::affine_element(P1);
+    for (size_t i = 1; i < with_data.size(); i++) {
+        accumulated.public_inputs.insert(accumulated.public_inputs.end(),
+                                         with_data[i]->public_inputs.begin(),
+                                         with_data[i]->public_inputs.end());
+    }
+    return accumulated;
+}
+
 AggregationObject aggregate_proofs(BaseOrMergeRollupPublicInputs const& left,
                                    BaseOrMergeRollupPublicInputs const& right)
 {
-    // TODO: NOTE: for now we simply return the aggregation object from the first proof
-    (void)right;
-    return left.end_aggregation_object;
+    return accumulate_aggregation_objects({ left.end_aggregation_object, right.end_aggregation_object });
+}
+
+/**
+ * @brief The pairing check an aggregation object defers: e(P0, [1]) * e(P1, [x]) == 1
+ * @return whether it holds (true for an object without data, which defers nothing)
+ */
+bool verify_aggregation_object(AggregationObject const& aggregation_object)
+{
+    if (!aggregation_object.has_data) {
+        return true;
+    }
+    std::array<barretenberg::g1::affine_element, 2> const P = { aggregation_object.P0, aggregation_object.P1 };
+    auto const verifier_crs = aztec3::utils::get_crs_factory()->get_verifier_crs();
+    auto const result = barretenberg::pairing::reduced_ate_pairing_batch_precomputed(
+        P.data(), verifier_crs->get_precomputed_g2_lines(), 2);
+    return result == barretenberg::fq12::one();
 }
 
 /**
@@ -171,18 +242,7 @@ std::array<fr, 2> compute_kernels_calldata_hash(std::array<abis::PreviousKernelD
         // calldata_hash_inputs[offset + i * 2 + 1] = unencryptedLogsHash[1];
     }
 
-    constexpr auto num_bytes = calldata_hash_inputs.size() * 32;
-    std::array<uint8_t, num_bytes> calldata_hash_inputs_bytes;
-    // Convert all into a buffer, then copy into the array, then hash
-    for (size_t i = 0; i < calldata_hash_inputs.size(); i++) {
-        auto as_bytes = calldata_hash_inputs[i].to_buffer();
-
-        auto offset = i * 32;
-        std::copy(as_bytes.begin(), as_bytes.end(), calldata_hash_inputs_bytes.begin() + offset);
-    }
-
-    std::vector<uint8_t> const calldata_hash_inputs_bytes_vec(calldata_hash_inputs_bytes.begin(),
-                                                              calldata_hash_inputs_bytes.end());
+    std::vector<uint8_t> const calldata_hash_inputs_bytes_vec = field_array_to_bytes(calldata_hash_inputs);
 
     auto h = sha256::sha256(calldata_hash_inputs_bytes_vec);
 
@@ -24,8 +24,10 @@ void assert_equal_constants(DummyComposer& composer,
                             BaseOrMergeRollupPublicInputs const& left,
                             BaseOrMergeRollupPublicInputs const& right);
 
+AggregationObject accumulate_aggregation_objects(std::vector<AggregationObject> const& aggregation_objects);
 AggregationObject aggregate_proofs(BaseOrMergeRollupPublicInputs const& left,
                                    BaseOrMergeRollupPublicInputs const& right);
+bool verify_aggregation_object(AggregationObject const& aggregation_object);
 
 template <size_t N> AppendOnlySnapshot insert_subtree_to_snapshot_tree(DummyComposer& composer,
                                                                        AppendOnlySnapshot snapshot,
@@ -3,6 +3,9 @@
 #include "index.hpp"
 
 #include "aztec3/utils/dummy_composer.hpp"
+#include "aztec3/utils/input_slot.hpp"
+#include "aztec3/utils/malloc_output.hpp"
+#include "aztec3/utils/scratch_arena.hpp"
 
 #include <barretenberg/barretenberg.hpp>
 
@@ -12,6 +15,27 @@ using DummyComposer = aztec3::utils::DummyComposer;
 using aztec3::circuits::abis::BaseOrMergeRollupPublicInputs;
 using aztec3::circuits::abis::MergeRollupInputs;
 using aztec3::circuits::rollup::merge::merge_rollup_circuit;
+using aztec3::utils::get_input_slot;
+using aztec3::utils::serialize_to_malloc_buffer;
+using aztec3::utils::serialize_to_scratch_arena;
+
+/**
+ * @brief Simulates the merge rollup on `composer`, returning what `merge_rollup__sim` returns
+ */
+uint8_t* sim_merge_rollup(DummyComposer& composer,
+                          uint8_t const* merge_rollup_inputs_buf,
+                          size_t* merge_rollup_public_inputs_size_out,
+                          uint8_t const** merge_rollup_public_inputs_buf)
+{
+    auto& merge_rollup_inputs = get_input_slot<MergeRollupInputs<NT>>();
+    read(merge_rollup_inputs_buf, merge_rollup_inputs);
+
+    BaseOrMergeRollupPublicInputs const public_inputs = merge_rollup_circuit(composer, merge_rollup_inputs);
+
+    return serialize_to_malloc_buffer(
+        composer, public_inputs, merge_rollup_public_inputs_size_out, merge_rollup_public_inputs_buf);
+}
+
 }  // namespace
 
 // WASM Cbinds
@@ -22,19 +46,39 @@ WASM_EXPORT uint8_t* merge_rollup__sim(uint8_t const* merge_rollup_inputs_buf,
                                        uint8_t const** merge_rollup_public_inputs_buf)
 {
     DummyComposer composer = DummyComposer("merge_rollup__sim");
-    MergeRollupInputs<NT> merge_rollup_inputs;
+    return sim_merge_rollup(
+        composer, merge_rollup_inputs_buf, merge_rollup_public_inputs_size_out, merge_rollup_public_inputs_buf);
+}
+
+/**
+ * @brief As `merge_rollup__sim`, in fail-fast mode (see `base_rollup__sim_fail_fast`)
+ */
+WASM_EXPORT uint8_t* merge_rollup__sim_fail_fast(uint8_t const* merge_rollup_inputs_buf,
+                                                 size_t* merge_rollup_public_inputs_size_out,
+                                                 uint8_t const** merge_rollup_public_inputs_buf)
+{
+    DummyComposer composer = DummyComposer("merge_rollup__sim_fail_fast", true);
+    return sim_merge_rollup(
+        composer, merge_rollup_inputs_buf, merge_rollup_public_inputs_size_out, merge_rollup_public_inputs_buf);
+}
+
+/**
+ * @brief As `merge_rollup__sim`, but the public inputs and the failure (if any) are serialized straight into the
+ * calling thread's scratch arena
+ * @details The returned pointers stay valid until the next `*_scratch` call on this thread or
+ * `scratch_arena__release`, and must not be freed.
+ */
+WASM_EXPORT uint8_t const* merge_rollup__sim_scratch(uint8_t const* merge_rollup_inputs_buf,
+                                                     size_t* merge_rollup_public_inputs_size_out,
+                                                     uint8_t const** merge_rollup_public_inputs_buf)
+{
+    DummyComposer composer = DummyComposer("merge_rollup__sim_scratch");
+    auto& merge_rollup_inputs = get_input_slot<MergeRollupInputs<NT>>();
     read(merge_rollup_inputs_buf, merge_rollup_inputs);
 
     BaseOrMergeRollupPublicInputs const public_inputs = merge_rollup_circuit(composer, merge_rollup_inputs);
 
-    // serialize public inputs to bytes vec
-    std::vector<uint8_t> public_inputs_vec;
-    write(public_inputs_vec, public_inputs);
-    // copy public inputs to output buffer
-    auto* raw_public_inputs_buf = (uint8_t*)malloc(public_inputs_vec.size());
-    memcpy(raw_public_inputs_buf, (void*)public_inputs_vec.data(), public_inputs_vec.size());
-    *merge_rollup_public_inputs_buf = raw_public_inputs_buf;
-    *merge_rollup_public_inputs_size_out = public_inputs_vec.size();
-    return composer.alloc_and_serialize_first_failure();
+    return serialize_to_scratch_arena(
+        composer, public_inputs, merge_rollup_public_inputs_size_out, merge_rollup_public_inputs_buf);
 }
 }  // extern "C"
\ No newline at end of file
@@ -10,4 +10,10 @@ extern "C" {
 WASM_EXPORT uint8_t* merge_rollup__sim(uint8_t const* merge_rollup_inputs_buf,
                                        size_t* merge_rollup_public_inputs_size_out,
                                        uint8_t const** merge_rollup_public_inputs_buf);
+WASM_EXPORT uint8_t* merge_rollup__sim_fail_fast(uint8_t const* merge_rollup_inputs_buf,
+                                                 size_t* merge_rollup_public_inputs_size_out,
+                                                 uint8_t const** merge_rollup_public_inputs_buf);
+WASM_EXPORT uint8_t const* merge_rollup__sim_scratch(uint8_t const* merge_rollup_inputs_buf,
+                                                     size_t* merge_rollup_public_inputs_size_out,
+                                                     uint8_t const** merge_rollup_public_inputs_buf);
 }
\ No newline at end of file
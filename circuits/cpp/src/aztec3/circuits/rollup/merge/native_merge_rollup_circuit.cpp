@@ -30,6 +30,10 @@ BaseOrMergeRollupPublicInputs merge_rollup_circuit(DummyComposer& composer, Merg
     components::assert_equal_constants(composer, left, right);
     components::assert_prev_rollups_follow_on_from_each_other(composer, left, right);
 
+    if (composer.should_stop()) {
+        return {};
+    }
+
     // compute calldata hash:
     auto new_calldata_hash = components::compute_calldata_hash(mergeRollupInputs.previous_rollup_data);
 
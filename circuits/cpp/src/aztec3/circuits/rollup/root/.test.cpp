@@ -9,11 +9,13 @@
 #include "aztec3/circuits/abis/previous_kernel_data.hpp"
 #include "aztec3/circuits/abis/rollup/merge/previous_rollup_data.hpp"
 #include "aztec3/circuits/kernel/private/utils.hpp"
+#include "aztec3/circuits/recursion/aggregator.hpp"
 #include "aztec3/circuits/rollup/base/init.hpp"
 #include "aztec3/circuits/rollup/components/components.hpp"
 #include "aztec3/circuits/rollup/test_utils/utils.hpp"
 #include "aztec3/constants.hpp"
 #include "aztec3/utils/dummy_composer.hpp"
+#include "aztec3/utils/types/convert.hpp"
 
 #include <barretenberg/barretenberg.hpp>
 
@@ -28,6 +30,7 @@ namespace {
 
 
 using aztec3::circuits::abis::PreviousKernelData;
+using aztec3::circuits::kernel::private_kernel::utils::dummy_previous_kernel;
 
 
 // using aztec3::circuits::mock::mock_circuit;
@@ -51,6 +54,28 @@ using aztec3::circuits::abis::NewContractData;
 
 using MemoryTree = stdlib::merkle_tree::MemoryTree;
 using KernelData = aztec3::circuits::abis::PreviousKernelData<NT>;
+
+/**
+ * @brief The aggregation object of recursively verifying a (mock) kernel proof, as a circuit verifying it would output
+ */
+NT::AggregationObject aggregation_object_of_kernel_proof()
+{
+    using Composer = aztec3::circuits::recursion::Composer;
+    using CT = aztec3::circuits::recursion::CT;
+    using aztec3::utils::types::to_nt;
+
+    auto const kernel = dummy_previous_kernel(true);
+    Composer composer = Composer(barretenberg::srs::get_crs_factory());
+    auto const aggregation_object = aztec3::circuits::recursion::Aggregator::aggregate(
+        &composer, CT::VK::from_witness(&composer, kernel.vk), kernel.proof, kernel.vk->num_public_inputs);
+    return NT::AggregationObject{
+        to_nt<Composer>(aggregation_object.P0),
+        to_nt<Composer>(aggregation_object.P1),
+        to_nt<Composer>(aggregation_object.public_inputs),
+        aggregation_object.proof_witness_indices,
+        true,
+    };
+}
 }  // namespace
 
 namespace aztec3::circuits::rollup::root::native_root_rollup_circuit {
@@ -302,4 +327,50 @@ TEST_F(root_rollup_tests, native_root_missing_nullifier_logic)
     run_cbind(rootRollupInputs, outputs, true);
 }
 
-}  // namespace aztec3::circuits::rollup::root::native_root_rollup_circuit
\ No newline at end of file
+TEST_F(root_rollup_tests, native_aggregation_objects_are_checked_once_at_the_root)
+{
+    barretenberg::srs::init_crs_factory("../barretenberg/cpp/srs_db/ignition");
+
+    auto const aggregation_object = aggregation_object_of_kernel_proof();
+    EXPECT_TRUE(components::verify_aggregation_object(aggregation_object));
+
+    auto tampered = aggregation_object;
+    tampered.P0 = barretenberg::g1::affine_element(barretenberg::g1::element(tampered.P0) + barretenberg::g1::one);
+    EXPECT_FALSE(components::verify_aggregation_object(tampered));
+
+    EXPECT_TRUE(components::verify_aggregation_object(
+        components::accumulate_aggregation_objects({ aggregation_object, aggregation_object })));
+    EXPECT_FALSE(components::verify_aggregation_object(
+        components::accumulate_aggregation_objects({ aggregation_object, tampered })));
+    // an object without data is left out of the fold
+    auto const folded_with_empty =
+        components::accumulate_aggregation_objects({ NT::AggregationObject{}, aggregation_object });
+    EXPECT_EQ(folded_with_empty.P0, aggregation_object.P0);
+    EXPECT_EQ(folded_with_empty.P1, aggregation_object.P1);
+
+    // folded up through the base and merge rollups, and checked at the root
+    for (bool const tamper : { false, true }) {
+        utils::DummyComposer composer =
+            utils::DummyComposer("root_rollup_tests__native_aggregation_objects_are_checked_once_at_the_root");
+        std::array<KernelData, 4> kernels = {
+            get_empty_kernel(), get_empty_kernel(), get_empty_kernel(), get_empty_kernel()
+        };
+        for (auto& kernel : kernels) {
+            kernel.public_inputs.end.aggregation_object = aggregation_object;
+        }
+        if (tamper) {
+            kernels[3].public_inputs.end.aggregation_object = tampered;
+        }
+
+        RootRollupInputs inputs = get_root_rollup_inputs(composer, kernels, get_empty_l1_to_l2_messages());
+        aztec3::circuits::rollup::native_root_rollup::root_rollup_circuit(composer, inputs);
+
+        EXPECT_EQ(composer.failed(), tamper);
+        if (tamper) {
+            EXPECT_EQ(composer.get_first_failure().code,
+                      utils::CircuitErrorCode::ROOT__AGGREGATION_OBJECT_PAIRING_CHECK_FAILED);
+        }
+    }
+}
+
+}  // namespace aztec3::circuits::rollup::root::native_root_rollup_circuit
@@ -4,6 +4,9 @@
 #include "init.hpp"
 
 #include "aztec3/constants.hpp"
+#include "aztec3/utils/input_slot.hpp"
+#include "aztec3/utils/malloc_output.hpp"
+#include "aztec3/utils/scratch_arena.hpp"
 #include "aztec3/utils/types/native_types.hpp"
 
 #include <barretenberg/barretenberg.hpp>
@@ -15,12 +18,35 @@ using DummyComposer = aztec3::utils::DummyComposer;
 using aztec3::circuits::rollup::native_root_rollup::root_rollup_circuit;
 using aztec3::circuits::rollup::native_root_rollup::RootRollupInputs;
 using aztec3::circuits::rollup::native_root_rollup::RootRollupPublicInputs;
+using aztec3::utils::get_input_slot;
+using aztec3::utils::serialize_to_malloc_buffer;
+using aztec3::utils::serialize_to_scratch_arena;
+
+/**
+ * @brief Simulates the root rollup on `composer`, returning what `root_rollup__sim` returns
+ */
+uint8_t* sim_root_rollup(DummyComposer& composer,
+                         uint8_t const* root_rollup_inputs_buf,
+                         size_t* root_rollup_public_inputs_size_out,
+                         uint8_t const** root_rollup_public_inputs_buf)
+{
+    auto& root_rollup_inputs = get_input_slot<RootRollupInputs>();
+    read(root_rollup_inputs_buf, root_rollup_inputs);
+
+    RootRollupPublicInputs const public_inputs = root_rollup_circuit(composer, root_rollup_inputs);
+
+    return serialize_to_malloc_buffer(
+        composer, public_inputs, root_rollup_public_inputs_size_out, root_rollup_public_inputs_buf);
+}
 
 }  // namespace
 
 // WASM Cbinds
 extern "C" {
 
+// TODO: still a placeholder. The root rollup is only simulated natively, and has no circuit to compute a proving key
+// from yet. Once it does, its keys belong in the `ProvingKeyCache` (with a `ProvingKeyCircuit` tag of their own) and
+// are serialized from there, as `private_kernel__init_proving_key` does.
 WASM_EXPORT size_t root_rollup__init_proving_key(uint8_t const** pk_buf)
 {
     std::vector<uint8_t> pk_vec(42, 0);
@@ -49,21 +75,41 @@ WASM_EXPORT uint8_t* root_rollup__sim(uint8_t const* root_rollup_inputs_buf,
                                       size_t* root_rollup_public_inputs_size_out,
                                       uint8_t const** root_rollup_public_inputs_buf)
 {
-    RootRollupInputs root_rollup_inputs;
+    DummyComposer composer = DummyComposer("root_rollup__sim");
+    return sim_root_rollup(
+        composer, root_rollup_inputs_buf, root_rollup_public_inputs_size_out, root_rollup_public_inputs_buf);
+}
+
+/**
+ * @brief As `root_rollup__sim`, in fail-fast mode (see `base_rollup__sim_fail_fast`)
+ */
+WASM_EXPORT uint8_t* root_rollup__sim_fail_fast(uint8_t const* root_rollup_inputs_buf,
+                                                size_t* root_rollup_public_inputs_size_out,
+                                                uint8_t const** root_rollup_public_inputs_buf)
+{
+    DummyComposer composer = DummyComposer("root_rollup__sim_fail_fast", true);
+    return sim_root_rollup(
+        composer, root_rollup_inputs_buf, root_rollup_public_inputs_size_out, root_rollup_public_inputs_buf);
+}
+
+/**
+ * @brief As `root_rollup__sim`, but the public inputs and the failure (if any) are serialized straight into the
+ * calling thread's scratch arena
+ * @details The returned pointers stay valid until the next `*_scratch` call on this thread or
+ * `scratch_arena__release`, and must not be freed.
+ */
+WASM_EXPORT uint8_t const* root_rollup__sim_scratch(uint8_t const* root_rollup_inputs_buf,
+                                                    size_t* root_rollup_public_inputs_size_out,
+                                                    uint8_t const** root_rollup_public_inputs_buf)
+{
+    auto& root_rollup_inputs = get_input_slot<RootRollupInputs>();
     read(root_rollup_inputs_buf, root_rollup_inputs);
 
-    DummyComposer composer = DummyComposer("root_rollup__sim");
+    DummyComposer composer = DummyComposer("root_rollup__sim_scratch");
     RootRollupPublicInputs const public_inputs = root_rollup_circuit(composer, root_rollup_inputs);
 
-    // serialize public inputs to bytes vec
-    std::vector<uint8_t> public_inputs_vec;
-    write(public_inputs_vec, public_inputs);
-    // copy public inputs to output buffer
-    auto* raw_public_inputs_buf = (uint8_t*)malloc(public_inputs_vec.size());
-    memcpy(raw_public_inputs_buf, (void*)public_inputs_vec.data(), public_inputs_vec.size());
-    *root_rollup_public_inputs_buf = raw_public_inputs_buf;
-    *root_rollup_public_inputs_size_out = public_inputs_vec.size();
-    return composer.alloc_and_serialize_first_failure();
+    return serialize_to_scratch_arena(
+        composer, public_inputs, root_rollup_public_inputs_size_out, root_rollup_public_inputs_buf);
 }
 
 WASM_EXPORT size_t root_rollup__verify_proof(uint8_t const* vk_buf, uint8_t const* proof, uint32_t length)
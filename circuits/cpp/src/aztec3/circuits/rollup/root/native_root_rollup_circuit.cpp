@@ -4,6 +4,7 @@
 #include "aztec3/circuits/abis/rollup/root/root_rollup_public_inputs.hpp"
 #include "aztec3/circuits/rollup/components/components.hpp"
 #include "aztec3/constants.hpp"
+#include "aztec3/utils/field_serialization.hpp"
 
 #include <algorithm>
 #include <array>
@@ -14,6 +15,8 @@
 
 namespace aztec3::circuits::rollup::native_root_rollup {
 
+using aztec3::utils::field_array_to_bytes;
+
 // TODO: can we aggregate proofs if we do not have a working circuit impl
 // TODO: change the public inputs array - we wont be using this?
 
@@ -41,17 +44,8 @@ NT::fr calculate_subtree(std::array<NT::fr, NUMBER_OF_L1_L2_MESSAGES_PER_ROLLUP>
  */
 std::array<NT::fr, 2> compute_messages_hash(std::array<NT::fr, NUMBER_OF_L1_L2_MESSAGES_PER_ROLLUP> leaves)
 {
-    // convert vector of field elements into uint_8
-    std::array<uint8_t, 32 * NUMBER_OF_L1_L2_MESSAGES_PER_ROLLUP> messages_hash_input_bytes;
-    for (size_t i = 0; i < NUMBER_OF_L1_L2_MESSAGES_PER_ROLLUP; i++) {
-        auto bytes = leaves[i].to_buffer();
-        for (size_t j = 0; j < 32; j++) {
-            messages_hash_input_bytes[i * 32 + j] = bytes[j];
-        }
-    }
-
-    std::vector<uint8_t> const messages_hash_input_bytes_vec(messages_hash_input_bytes.begin(),
-                                                             messages_hash_input_bytes.end());
+    // convert array of field elements into uint_8
+    std::vector<uint8_t> const messages_hash_input_bytes_vec = field_array_to_bytes(leaves);
     auto h = sha256::sha256(messages_hash_input_bytes_vec);
 
     std::array<uint8_t, 32> buf_1;
@@ -83,6 +77,15 @@ RootRollupPublicInputs root_rollup_circuit(DummyComposer& composer, RootRollupIn
     components::assert_equal_constants(composer, left, right);
     components::assert_prev_rollups_follow_on_from_each_other(composer, left, right);
 
+    // The one pairing check of every proof aggregated up the rollup tree
+    composer.do_assert(components::verify_aggregation_object(aggregation_object),
+                       "aggregation object pairing check failed",
+                       utils::CircuitErrorCode::ROOT__AGGREGATION_OBJECT_PAIRING_CHECK_FAILED);
+
+    if (composer.should_stop()) {
+        return {};
+    }
+
     // Update the historic private data tree
     auto end_tree_of_historic_private_data_tree_roots_snapshot = components::insert_subtree_to_snapshot_tree(
         composer,
@@ -103,6 +106,10 @@ RootRollupPublicInputs root_rollup_circuit(DummyComposer& composer, RootRollupIn
                                                     0,
                                                     "historic contract tree roots insertion");
 
+    if (composer.should_stop()) {
+        return {};
+    }
+
     // Check correct l1 to l2 tree given
     // Compute subtree inserting l1 to l2 messages
     auto l1_to_l2_subtree_root = calculate_subtree(rootRollupInputs.l1_to_l2_messages);
@@ -118,6 +125,10 @@ RootRollupPublicInputs root_rollup_circuit(DummyComposer& composer, RootRollupIn
                                                     L1_TO_L2_MSG_SUBTREE_DEPTH,
                                                     "l1 to l2 message tree insertion");
 
+    if (composer.should_stop()) {
+        return {};
+    }
+
     // Update the historic l1 to l2 data tree
     auto end_l1_to_l2_data_roots_tree_snapshot = components::insert_subtree_to_snapshot_tree(
         composer,
@@ -0,0 +1,96 @@
+#pragma once
+
+#include "aztec3/constants.hpp"
+#include "aztec3/utils/lru_cache.hpp"
+#include "aztec3/utils/types/native_types.hpp"
+
+#include <barretenberg/barretenberg.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace aztec3::circuits {
+
+using aztec3::utils::CacheStats;
+using aztec3::utils::LruCache;
+using NT = aztec3::utils::types::NativeTypes;
+
+// A handful of contracts' functions make up nearly every call, so a small cache is enough to catch them
+constexpr size_t VK_HASH_CACHE_CAPACITY = 128;
+
+/**
+ * @brief The vk hashes are computed by two different functions (one on `verification_key`, one on
+ * `verification_key_data`), so every cache key is prefixed with the form it was computed from.
+ */
+enum class VkHashCacheKeyKind : uint8_t { VERIFICATION_KEY = 0, VERIFICATION_KEY_DATA = 1 };
+
+using VkHashCache = LruCache<std::string, NT::fr>;
+
+/**
+ * @brief The process-wide cache of compressed vk hashes, keyed by a blake2s digest of the vks' serialized bytes
+ */
+inline VkHashCache& get_vk_hash_cache()
+{
+    static VkHashCache cache(VK_HASH_CACHE_CAPACITY);
+    return cache;
+}
+
+inline CacheStats get_vk_hash_cache_stats()
+{
+    return get_vk_hash_cache().stats();
+}
+
+/**
+ * @brief The cache key of a serialized vk: its kind, then the blake2s digest of its bytes
+ * @details A vk runs to kilobytes, so keying on its digest keeps the cache small and its lookups cheap. Finding two
+ * vks with the same digest means finding a blake2s collision.
+ */
+inline std::string vk_hash_cache_key(VkHashCacheKeyKind kind, std::vector<uint8_t> const& vk_bytes)
+{
+    auto const digest = blake2::blake2s(vk_bytes);
+    std::string key(digest.size() + 1, '\0');
+    key[0] = static_cast<char>(kind);
+    std::copy(digest.begin(), digest.end(), key.begin() + 1);
+    return key;
+}
+
+/**
+ * @brief Pedersen compress a verification key (as the kernel does for the function leaf), memoised on its bytes
+ * @details Compressing a vk hashes every one of its commitments, while serializing it is a copy. The full serialized
+ * vk's digest is the cache key, so a hit returns the hash of a different vk only on a blake2s collision.
+ * @param vk the verification key to compress
+ * @return the vk hash, as given by `verification_key<bn254>::compress_native(vk, GeneratorIndex::VK)`
+ */
+inline NT::fr compress_vk_native(std::shared_ptr<NT::VK> const& vk)
+{
+    std::vector<uint8_t> vk_bytes;
+    write(vk_bytes, *vk);
+    auto const key = vk_hash_cache_key(VkHashCacheKeyKind::VERIFICATION_KEY, vk_bytes);
+
+    return get_vk_hash_cache().get_or_compute(key, [&]() {
+        return stdlib::recursion::verification_key<stdlib::bn254<plonk::UltraPlonkComposer>>::compress_native(
+            vk, GeneratorIndex::VK);
+    });
+}
+
+/**
+ * @brief Pedersen compress verification key data, memoised on its bytes
+ * @param vk_data the verification key data to compress
+ * @param vk_data_bytes the serialized form of `vk_data` (as it was read from), whose digest is the cache key
+ * @param vk_data_bytes_size the length of `vk_data_bytes`
+ * @return the vk hash, as given by `vk_data.compress_native(GeneratorIndex::VK)`
+ */
+inline NT::fr compress_vk_data_native(NT::VKData const& vk_data,
+                                      uint8_t const* vk_data_bytes,
+                                      size_t vk_data_bytes_size)
+{
+    auto const key = vk_hash_cache_key(VkHashCacheKeyKind::VERIFICATION_KEY_DATA,
+                                       std::vector<uint8_t>(vk_data_bytes, vk_data_bytes + vk_data_bytes_size));
+
+    return get_vk_hash_cache().get_or_compute(key, [&]() { return vk_data.compress_native(GeneratorIndex::VK); });
+}
+
+}  // namespace aztec3::circuits
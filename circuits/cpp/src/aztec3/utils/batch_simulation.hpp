@@ -0,0 +1,77 @@
+#pragma once
+#include "aztec3/utils/circuit_errors.hpp"
+#include "aztec3/utils/dummy_composer.hpp"
+#include "aztec3/utils/hash_tables.hpp"
+
+#include <barretenberg/common/thread.hpp>
+
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace aztec3::utils {
+
+/**
+ * @brief The per-item outputs and first failures of a batch of native circuit simulations
+ * @details Both vectors are in input order. An item which succeeded has a `CircuitErrorCode::NO_ERROR` error.
+ * @tparam Output the circuit's output (public inputs) type
+ */
+template <typename Output> struct BatchSimulationResult {
+    std::vector<Output> outputs;
+    std::vector<CircuitError> errors;
+
+    /**
+     * @brief Pairs every output with its error, in the form returned by msgpack cbinds
+     * @return one CircuitResult per item, holding the error if the item failed and its output otherwise
+     */
+    [[nodiscard]] std::vector<CircuitResult<Output>> to_circuit_results() const
+    {
+        std::vector<CircuitResult<Output>> results;
+        results.reserve(outputs.size());
+        for (size_t i = 0; i < outputs.size(); i++) {
+            if (errors[i].code != CircuitErrorCode::NO_ERROR) {
+                results.emplace_back(errors[i]);
+            } else {
+                results.emplace_back(outputs[i]);
+            }
+        }
+        return results;
+    }
+};
+
+/**
+ * @brief Simulates a native circuit over a batch of independent inputs
+ * @details Every item gets its own DummyComposer, so a failing item does not affect the others. The items are
+ * spread over barretenberg's thread pool, which runs them sequentially when built without MULTITHREADING (e.g. WASM).
+ * Every hashing table is built (see `init_hash_tables`) before any worker thread runs, as items may hash differently.
+ * @tparam Input the circuit's input type
+ * @tparam Circuit a callable `Output(DummyComposer&, Input const&)`
+ * @param method_name name given to each item's composer, used for logging
+ * @param inputs the inputs to simulate
+ * @param circuit the native circuit
+ * @return the outputs and first failures, in input order
+ */
+template <typename Input, typename Circuit>
+auto simulate_batch(std::string const& method_name, std::vector<Input> const& inputs, Circuit const& circuit)
+{
+    using Output = std::invoke_result_t<Circuit const&, DummyComposer&, Input const&>;
+
+    BatchSimulationResult<Output> result{ .outputs = std::vector<Output>(inputs.size()),
+                                          .errors = std::vector<CircuitError>(inputs.size()) };
+    if (inputs.empty()) {
+        return result;
+    }
+    init_hash_tables();
+
+    auto simulate_item = [&](size_t i) {
+        DummyComposer composer = DummyComposer(method_name);
+        result.outputs[i] = circuit(composer, inputs[i]);
+        result.errors[i] = composer.get_first_failure();
+    };
+
+    parallel_for(inputs.size(), simulate_item);
+
+    return result;
+}
+
+}  // namespace aztec3::utils
@@ -0,0 +1,191 @@
+#pragma once
+#include "./array.hpp"
+
+#include "aztec3/utils/circuit_errors.hpp"
+
+#include <barretenberg/barretenberg.hpp>
+
+#include <array>
+#include <cstddef>
+#include <ostream>
+#include <vector>
+
+namespace aztec3::utils {
+
+/**
+ * @brief A fixed-capacity array of up to N items which keeps track of where its first empty slot is
+ *
+ * @details The native counterpart of the left-packed `std::array<T, N>`s of the kernel outputs (the items first, then
+ * 'empty' values only), for code which adds to them repeatedly. Where `array_push` and `push_array_to_array` rescan
+ * the array for its first empty slot on every call, `push` is O(1) and `append` is O(k) in the size of what is
+ * appended. It serializes exactly like the `std::array<T, N>` it wraps, so it can be converted to and from the ABI
+ * structs' arrays freely.
+ *
+ * `push` and `append` fill the array exactly as `array_push` and `push_array_to_array` fill the `std::array` it was
+ * built from, and report the same failures to the composer, even for an array which is not left-packed (as the inputs
+ * of a native simulation need not be). Only the stray items after the first gap of such an array cost extra work.
+ *
+ * Invariant: `data[i]` is non-empty for every `i < length`, `data[length]` is empty (if `length < N`), and `stray`
+ * items follow it.
+ *
+ * @tparam T the item type (anything `is_empty` / `empty_value` handle)
+ * @tparam N the capacity
+ */
+template <typename T, size_t N> class BoundedArray {
+  public:
+    BoundedArray()
+    {
+        for (auto& e : data) {
+            e = empty_value<T>();
+        }
+    }
+
+    /**
+     * @brief Wraps `arr`, finding its first empty slot (and any stray items after it) with one scan
+     */
+    explicit BoundedArray(std::array<T, N> const& arr)
+        : data(arr)
+    {
+        recount();
+    }
+
+    /**
+     * @brief Adds `value` in the first empty slot, as `array_push` does, in O(1) unless stray items follow that slot
+     * @details Fails if there is no empty slot left.
+     */
+    template <typename Composer> void push(Composer& composer, T const& value)
+    {
+        if (length == N) {
+            composer.do_assert(false, "array_push cannot push to a full array", CircuitErrorCode::ARRAY_OVERFLOW);
+            return;
+        }
+        data[length] = value;
+        if (!is_empty(value)) {
+            skip_to_first_empty(length + 1);
+        }
+    }
+
+    /**
+     * @brief Adds the non-empty items of `source` from the first empty slot on, in order, as `push_array_to_array`
+     * does, in O(M) unless stray items follow that slot
+     * @details Fails if `source`'s leading items do not fit in the slots left, and once for every stray item (which is
+     * then overwritten, or kept if nothing lands on it). Items which do not fit are dropped.
+     */
+    template <typename Composer, size_t M> void append(Composer& composer, std::array<T, M> const& source)
+    {
+        composer.do_assert(array_length(source) <= N - length,
+                           "push_array_to_array cannot overflow the target",
+                           CircuitErrorCode::ARRAY_OVERFLOW);
+        for (size_t i = 0; i < stray; i++) {
+            composer.do_assert(false,
+                               "push_array_to_array inserting new array into a non empty space",
+                               CircuitErrorCode::ARRAY_OVERFLOW);
+        }
+
+        size_t index = length;
+        for (auto const& e : source) {
+            if (!is_empty(e) && index < N) {
+                data[index++] = e;
+            }
+        }
+        if (stray == 0) {
+            length = index;
+        } else {
+            recount();
+        }
+    }
+
+    /**
+     * @brief Removes and returns the last item, as `array_pop` does, in O(1) unless there are stray items
+     */
+    T pop()
+    {
+        if (stray > 0) {
+            for (size_t i = N - 1; i > length; i--) {
+                if (!is_empty(data[i])) {
+                    T const last = data[i];
+                    data[i] = empty_value<T>();
+                    stray--;
+                    return last;
+                }
+            }
+        }
+        if (length == 0) {
+            throw_or_abort("array_pop cannot pop from an empty array");
+        }
+        T const last = data[--length];
+        data[length] = empty_value<T>();
+        return last;
+    }
+
+    /**
+     * @brief The number of items before the first empty slot (all of them, for a left-packed array)
+     */
+    [[nodiscard]] size_t size() const { return length; }
+    [[nodiscard]] bool empty() const { return length == 0 && stray == 0; }
+    static constexpr size_t capacity() { return N; }
+
+    T const& operator[](size_t i) const { return data[i]; }
+
+    /**
+     * @brief The underlying array, laid out as in the ABI structs (items first, then empty values)
+     */
+    [[nodiscard]] std::array<T, N> const& array() const { return data; }
+
+    bool operator==(BoundedArray const& other) const { return data == other.data; }
+
+  private:
+    void recount()
+    {
+        length = array_length(data);
+        stray = 0;
+        for (size_t i = length; i < N; i++) {
+            if (!is_empty(data[i])) {
+                stray++;
+            }
+        }
+    }
+
+    // moves `length` to the first empty slot at or after `from`, passing over stray items
+    void skip_to_first_empty(size_t from)
+    {
+        length = from;
+        while (stray > 0 && length < N && !is_empty(data[length])) {
+            length++;
+            stray--;
+        }
+    }
+
+    std::array<T, N> data;
+    size_t length = 0;
+    size_t stray = 0;
+};
+
+/**
+ * @brief Reads a bounded array from its fixed-array wire form, recovering the length from the empty slots
+ */
+template <typename T, size_t N> void read(uint8_t const*& it, BoundedArray<T, N>& value)
+{
+    using serialize::read;
+
+    std::array<T, N> arr;
+    read(it, arr);
+    value = BoundedArray<T, N>(arr);
+}
+
+/**
+ * @brief Writes a bounded array exactly as the `std::array<T, N>` it wraps
+ */
+template <typename T, size_t N> void write(std::vector<uint8_t>& buf, BoundedArray<T, N> const& value)
+{
+    using serialize::write;
+
+    write(buf, value.array());
+}
+
+template <typename T, size_t N> std::ostream& operator<<(std::ostream& os, BoundedArray<T, N> const& value)
+{
+    return os << value.array();
+}
+
+}  // namespace aztec3::utils
@@ -0,0 +1,146 @@
+#include "array.hpp"
+#include "bounded_array.hpp"
+#include "circuit_errors.hpp"
+#include "dummy_composer.hpp"
+
+#include "aztec3/utils/types/native_types.hpp"
+
+#include <barretenberg/barretenberg.hpp>
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+namespace {
+
+using NT = aztec3::utils::types::NativeTypes;
+
+}  // namespace
+
+namespace aztec3::utils {
+
+namespace {
+
+/**
+ * @brief Expects the same failures, in the same order, to have been reported to both composers
+ */
+void expect_same_failures(DummyComposer const& composer, DummyComposer const& expected_composer)
+{
+    ASSERT_EQ(composer.failure_msgs.size(), expected_composer.failure_msgs.size());
+    for (size_t i = 0; i < composer.failure_msgs.size(); i++) {
+        EXPECT_EQ(composer.failure_msgs[i].code, expected_composer.failure_msgs[i].code);
+        EXPECT_EQ(composer.failure_msgs[i].message, expected_composer.failure_msgs[i].message);
+    }
+}
+
+}  // namespace
+
+TEST(bounded_array_tests, serializes_as_fixed_array)
+{
+    DummyComposer dummyComposer = DummyComposer("bounded_array_tests__serializes_as_fixed_array");
+
+    std::array<NT::fr, 8> fixed = zero_array<NT::fr, 8>();
+    fixed[0] = NT::fr(1);
+    fixed[1] = NT::fr(2);
+    BoundedArray<NT::fr, 8> bounded(fixed);
+    ASSERT_EQ(bounded.size(), 2U);
+
+    // push and append land where array_push and push_array_to_array would put them
+    bounded.push(dummyComposer, NT::fr(3));
+    array_push(dummyComposer, fixed, NT::fr(3));
+    std::array<NT::fr, 4> const source = { NT::fr(0), NT::fr(4), NT::fr(0), NT::fr(5) };
+    bounded.append(dummyComposer, source);
+    push_array_to_array(dummyComposer, source, fixed);
+    ASSERT_FALSE(dummyComposer.failed());
+    ASSERT_EQ(bounded.size(), 5U);
+    ASSERT_EQ(bounded.array(), fixed);
+
+    using serialize::read;
+    using serialize::write;
+
+    std::vector<uint8_t> bounded_bytes;
+    std::vector<uint8_t> fixed_bytes;
+    write(bounded_bytes, bounded);
+    write(fixed_bytes, fixed);
+    ASSERT_EQ(bounded_bytes, fixed_bytes);
+
+    BoundedArray<NT::fr, 8> read_back;
+    uint8_t const* it = bounded_bytes.data();
+    read(it, read_back);
+    ASSERT_EQ(read_back, bounded);
+
+    ASSERT_EQ(bounded.pop(), NT::fr(5));
+    ASSERT_EQ(bounded.size(), 4U);
+}
+
+TEST(bounded_array_tests, fails_as_array_push_does)
+{
+    // pushing into a full array fails once per item, and wrapping an array never fails
+    DummyComposer composer = DummyComposer("bounded_array_tests__fails_as_array_push_does");
+    DummyComposer expected_composer = DummyComposer("bounded_array_tests__fails_as_array_push_does__e");
+    std::array<NT::fr, 2> fixed = { NT::fr(1), NT::fr(0) };
+    BoundedArray<NT::fr, 2> bounded(fixed);
+    for (auto const value : { NT::fr(2), NT::fr(3), NT::fr(4) }) {
+        bounded.push(composer, value);
+        array_push(expected_composer, fixed, value);
+    }
+    ASSERT_EQ(expected_composer.failure_msgs.size(), 2U);
+    expect_same_failures(composer, expected_composer);
+    EXPECT_EQ(bounded.array(), fixed);
+
+    // an array which is not left-packed is filled from its gaps, as array_push fills it
+    DummyComposer gap_composer = DummyComposer("bounded_array_tests__fails_as_array_push_does__gap");
+    DummyComposer expected_gap_composer =
+        DummyComposer("bounded_array_tests__fails_as_array_push_does__expected_gap");
+    std::array<NT::fr, 5> gapped = { NT::fr(1), NT::fr(0), NT::fr(2), NT::fr(0), NT::fr(3) };
+    BoundedArray<NT::fr, 5> bounded_gapped(gapped);
+    for (auto const value : { NT::fr(4), NT::fr(5), NT::fr(6) }) {
+        bounded_gapped.push(gap_composer, value);
+        array_push(expected_gap_composer, gapped, value);
+        EXPECT_EQ(bounded_gapped.array(), gapped);
+    }
+    expect_same_failures(gap_composer, expected_gap_composer);
+    EXPECT_EQ(bounded_gapped.pop(), array_pop(gapped));
+    EXPECT_EQ(bounded_gapped.array(), gapped);
+}
+
+TEST(bounded_array_tests, fails_as_push_array_to_array_does)
+{
+    // appending over the stray items after a gap fails once for each of them
+    DummyComposer composer = DummyComposer("bounded_array_tests__fails_as_push_array_to_array_does");
+    DummyComposer expected_composer =
+        DummyComposer("bounded_array_tests__fails_as_push_array_to_array_does__expected");
+    std::array<NT::fr, 8> gapped = { NT::fr(1), NT::fr(0), NT::fr(0), NT::fr(2),
+                                     NT::fr(0), NT::fr(3), NT::fr(0), NT::fr(0) };
+    BoundedArray<NT::fr, 8> bounded(gapped);
+    std::array<NT::fr, 3> const source = { NT::fr(4), NT::fr(0), NT::fr(5) };
+    bounded.append(composer, source);
+    push_array_to_array(expected_composer, source, gapped);
+    ASSERT_EQ(expected_composer.failure_msgs.size(), 2U);
+    expect_same_failures(composer, expected_composer);
+    EXPECT_EQ(bounded.array(), gapped);
+
+    // what follows sees the array as push_array_to_array left it
+    bounded.push(composer, NT::fr(6));
+    array_push(expected_composer, gapped, NT::fr(6));
+    bounded.append(composer, source);
+    push_array_to_array(expected_composer, source, gapped);
+    expect_same_failures(composer, expected_composer);
+    EXPECT_EQ(bounded.array(), gapped);
+
+    // an overflow fails as push_array_to_array's does (which then writes past the end: the bounded array drops what
+    // does not fit instead)
+    DummyComposer overflow_composer = DummyComposer("bounded_array_tests__overflow");
+    BoundedArray<NT::fr, 2> full;
+    full.push(overflow_composer, NT::fr(1));
+    std::array<NT::fr, 2> const too_many = { NT::fr(2), NT::fr(3) };
+    full.append(overflow_composer, too_many);
+    ASSERT_EQ(overflow_composer.failure_msgs.size(), 1U);
+    EXPECT_EQ(overflow_composer.get_first_failure().code, CircuitErrorCode::ARRAY_OVERFLOW);
+    EXPECT_EQ(overflow_composer.get_first_failure().message, "push_array_to_array cannot overflow the target");
+    EXPECT_EQ(full.array(), (std::array<NT::fr, 2>{ NT::fr(1), NT::fr(2) }));
+}
+
+}  // namespace aztec3::utils
@@ -81,6 +81,7 @@ enum CircuitErrorCode : uint16_t {
     ARRAY_OVERFLOW = 7009,
 
     ROOT_CIRCUIT_FAILED = 8000,
+    ROOT__AGGREGATION_OBJECT_PAIRING_CHECK_FAILED = 8001,
 
 };
 
@@ -0,0 +1,34 @@
+#pragma once
+
+#include <barretenberg/srs/factories/crs_factory.hpp>
+#include <barretenberg/srs/global_crs.hpp>
+
+#include <memory>
+
+namespace aztec3::utils {
+
+using CrsFactory = barretenberg::srs::factories::CrsFactory;
+
+/**
+ * @brief The factory set by `init_mmap_crs_factory` (see mmap_crs_factory.hpp) or `init_thread_safe_crs_factory` (see
+ * thread_safe_crs_factory.hpp), if any
+ */
+inline std::shared_ptr<CrsFactory>& get_crs_factory_slot()
+{
+    static std::shared_ptr<CrsFactory> factory;
+    return factory;
+}
+
+/**
+ * @brief The CRS factory the circuits prove and verify with: the one set by `init_mmap_crs_factory` or
+ * `init_thread_safe_crs_factory` if any, else barretenberg's global one
+ */
+inline std::shared_ptr<CrsFactory> get_crs_factory()
+{
+    if (auto const& factory = get_crs_factory_slot()) {
+        return factory;
+    }
+    return barretenberg::srs::get_crs_factory();
+}
+
+}  // namespace aztec3::utils
@@ -3,6 +3,7 @@
 
 #include <iostream>
 #include <string>
+#include <type_traits>
 #include <utility>
 #include <variant>
 #include <vector>
@@ -14,8 +15,14 @@ class DummyComposer {
     std::vector<CircuitError> failure_msgs;
     // method that created this composer instance. Useful for logging.
     std::string method_name;
+    // in fail-fast mode the native circuits skip their remaining stages once an assertion has failed
+    bool fail_fast = false;
 
     explicit DummyComposer(std::string method_name) : method_name(std::move(method_name)) {}
+    DummyComposer(std::string method_name, bool fail_fast)
+        : method_name(std::move(method_name))
+        , fail_fast(fail_fast)
+    {}
 
     void do_assert(bool const& assertion, std::string const& msg, CircuitErrorCode error_code)
     {
@@ -27,8 +34,33 @@ class DummyComposer {
         }
     }
 
+    /**
+     * @brief As above, but the failure message is only built if the assertion fails
+     * @details Use this whenever building the message costs anything (e.g. `format`ting field elements), as the
+     * success path then never pays for it.
+     * @param assertion the condition which must hold
+     * @param make_msg a callable `std::string()` producing the failure message
+     * @param error_code the error code recorded on failure
+     */
+    template <typename MessageProducer>
+        requires std::is_invocable_r_v<std::string, MessageProducer const&>
+    void do_assert(bool const& assertion, MessageProducer const& make_msg, CircuitErrorCode error_code)
+    {
+        if (!assertion) {
+            do_assert(assertion, std::string(make_msg()), error_code);
+        }
+    }
+
     [[nodiscard]] bool failed() const { return !failure_msgs.empty(); }
 
+    /**
+     * @brief Whether a circuit should skip the rest of its stages, checked by the native circuits at stage boundaries
+     * @details Only ever true in fail-fast mode. The first failure is kept as is, so only the later (follow-on)
+     * failures are lost, and the outputs of the skipped stages are left empty.
+     * @return true if this is a fail-fast composer and an assertion has already failed
+     */
+    [[nodiscard]] bool should_stop() const { return fail_fast && failed(); }
+
     CircuitError get_first_failure()
     {
         if (failed()) {
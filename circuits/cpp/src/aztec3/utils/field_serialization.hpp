@@ -0,0 +1,139 @@
+#pragma once
+#include "./types/native_types.hpp"
+
+#include <barretenberg/barretenberg.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+namespace aztec3::utils {
+
+using NT = types::NativeTypes;
+
+/**
+ * @brief The serialized size of a field element: its canonical value as 4 big-endian 64-bit limbs
+ */
+constexpr size_t FIELD_SERIALIZED_SIZE = 32;
+
+/**
+ * @brief Encodes `count` field elements as consecutive 32-byte big-endian values, as `write` does one at a time
+ * @details Each element is taken out of Montgomery form and its limbs stored straight into `out`, with no
+ * intermediate buffer per element. `out` must have room for `count * FIELD_SERIALIZED_SIZE` bytes.
+ */
+inline void fields_to_buffer(NT::fr const* fields, size_t count, uint8_t* out)
+{
+    for (size_t i = 0; i < count; ++i) {
+        NT::fr const reduced = fields[i].from_montgomery_form();
+        uint8_t* element_out = out + i * FIELD_SERIALIZED_SIZE;
+        for (size_t limb = 0; limb < 4; ++limb) {
+            uint64_t const value = reduced.data[3 - limb];
+            for (size_t byte = 0; byte < 8; ++byte) {
+                element_out[limb * 8 + byte] = static_cast<uint8_t>(value >> (56 - 8 * byte));
+            }
+        }
+    }
+}
+
+/**
+ * @brief Decodes `count` consecutive 32-byte big-endian values into field elements, as `read` does one at a time
+ */
+inline void fields_from_buffer(uint8_t const* in, size_t count, NT::fr* fields)
+{
+    for (size_t i = 0; i < count; ++i) {
+        uint8_t const* element_in = in + i * FIELD_SERIALIZED_SIZE;
+        std::array<uint64_t, 4> limbs{};
+        for (size_t limb = 0; limb < 4; ++limb) {
+            uint64_t value = 0;
+            for (size_t byte = 0; byte < 8; ++byte) {
+                value = (value << 8) | static_cast<uint64_t>(element_in[limb * 8 + byte]);
+            }
+            limbs[3 - limb] = value;
+        }
+        fields[i] = NT::fr(limbs[0], limbs[1], limbs[2], limbs[3]).to_montgomery_form();
+    }
+}
+
+/**
+ * @brief Whether T is a field element or a (possibly nested) fixed-size array of them, i.e. a run of field elements
+ * laid out back to back both in memory and when serialized
+ */
+template <typename T> struct IsFieldArray : std::is_same<T, NT::fr> {};
+template <typename T, size_t N> struct IsFieldArray<std::array<T, N>> : IsFieldArray<T> {};
+
+template <typename T> struct FieldCount : std::integral_constant<size_t, 1> {};
+template <typename T, size_t N>
+struct FieldCount<std::array<T, N>> : std::integral_constant<size_t, N * FieldCount<T>::value> {};
+
+template <typename T> void fields_to_buffer(T const& value, uint8_t* out)
+{
+    if constexpr (std::is_same_v<T, NT::fr>) {
+        fields_to_buffer(&value, 1, out);
+    } else if constexpr (std::is_same_v<typename T::value_type, NT::fr>) {
+        fields_to_buffer(value.data(), value.size(), out);
+    } else {
+        constexpr size_t item_size = FieldCount<typename T::value_type>::value * FIELD_SERIALIZED_SIZE;
+        for (size_t i = 0; i < value.size(); ++i) {
+            fields_to_buffer(value[i], out + i * item_size);
+        }
+    }
+}
+
+template <typename T> void fields_from_buffer(uint8_t const* in, T& value)
+{
+    if constexpr (std::is_same_v<T, NT::fr>) {
+        fields_from_buffer(in, 1, &value);
+    } else if constexpr (std::is_same_v<typename T::value_type, NT::fr>) {
+        fields_from_buffer(in, value.size(), value.data());
+    } else {
+        constexpr size_t item_size = FieldCount<typename T::value_type>::value * FIELD_SERIALIZED_SIZE;
+        for (size_t i = 0; i < value.size(); ++i) {
+            fields_from_buffer(in + i * item_size, value[i]);
+        }
+    }
+}
+
+/**
+ * @brief `write` for a (possibly nested) array of field elements, growing `buf` once for the whole array
+ * @details Anything that is not a field array (e.g. the circuit types' arrays) is written as `write` does.
+ */
+template <typename T> void write_field_array(std::vector<uint8_t>& buf, T const& value)
+{
+    if constexpr (IsFieldArray<T>::value) {
+        size_t const offset = buf.size();
+        buf.resize(offset + FieldCount<T>::value * FIELD_SERIALIZED_SIZE);
+        fields_to_buffer(value, buf.data() + offset);
+    } else {
+        using serialize::write;
+        write(buf, value);
+    }
+}
+
+/**
+ * @brief `read` for a (possibly nested) array of field elements
+ * @details Anything that is not a field array is read as `read` does.
+ */
+template <typename T> void read_field_array(uint8_t const*& it, T& value)
+{
+    if constexpr (IsFieldArray<T>::value) {
+        fields_from_buffer(it, value);
+        it += FieldCount<T>::value * FIELD_SERIALIZED_SIZE;
+    } else {
+        using serialize::read;
+        read(it, value);
+    }
+}
+
+/**
+ * @brief The serialized bytes of an array of field elements, e.g. as input to a byte-oriented hash
+ */
+template <size_t N> std::vector<uint8_t> field_array_to_bytes(std::array<NT::fr, N> const& fields)
+{
+    std::vector<uint8_t> bytes(N * FIELD_SERIALIZED_SIZE);
+    fields_to_buffer(fields.data(), N, bytes.data());
+    return bytes;
+}
+
+}  // namespace aztec3::utils
@@ -0,0 +1,68 @@
+#pragma once
+
+#include "aztec3/constants.hpp"
+#include "aztec3/utils/types/native_types.hpp"
+
+#include <barretenberg/barretenberg.hpp>
+
+#include <cstddef>
+
+namespace aztec3::utils {
+
+namespace detail {
+
+inline bool build_hash_tables()
+{
+    using NT = aztec3::utils::types::NativeTypes;
+
+    // the lookup tables of the merkle hash
+    NT::merkle_hash(NT::fr(0), NT::fr(0));
+    // the generators (and their ladders) of every hash index we compress with
+    NT::compress({ NT::fr(0), NT::fr(0) }, 0);
+    for (auto hash_index = static_cast<size_t>(GeneratorIndex::COMMITMENT);
+         hash_index <= static_cast<size_t>(GeneratorIndex::FUNCTION_ARGS);
+         hash_index++) {
+        NT::compress({ NT::fr(0), NT::fr(0) }, hash_index);
+    }
+    return true;
+}
+
+inline bool build_circuit_hash_tables()
+{
+    using Composer = plonk::UltraPlonkComposer;
+
+    // building one in-circuit pedersen hash builds every plookup table
+    Composer composer = Composer(barretenberg::srs::get_crs_factory());
+    plonk::stdlib::pedersen_commitment<Composer>::compress(
+        plonk::stdlib::field_t<Composer>(plonk::stdlib::witness_t<Composer>(&composer, 0)),
+        plonk::stdlib::field_t<Composer>(plonk::stdlib::witness_t<Composer>(&composer, 0)));
+    return true;
+}
+
+}  // namespace detail
+
+/**
+ * @brief Builds barretenberg's pedersen generator and lookup tables for every hash the circuits compute natively
+ *
+ * @details Barretenberg builds each table the first time a hash needs it, so the first simulation in a fresh process
+ * (or WASM instance) pays for all of them on top of its own work. Calling this once, while the process (or instance)
+ * starts up, moves that cost off the first simulation's path. Only the first call does any work, and it must happen
+ * before any other thread hashes: the tables are not built under a lock.
+ */
+inline void init_hash_tables()
+{
+    static bool const built = detail::build_hash_tables();
+    (void)built;
+}
+
+/**
+ * @brief As `init_hash_tables`, for the lookup tables of the hashes computed in UltraPlonk circuits
+ * @details Needed before several threads first build (or prove) circuits at once, e.g. by the proving service.
+ */
+inline void init_circuit_hash_tables()
+{
+    static bool const built = detail::build_circuit_hash_tables();
+    (void)built;
+}
+
+}  // namespace aztec3::utils
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <vector>
+
+namespace aztec3::utils {
+
+/**
+ * @brief How to free each of the calling thread's input slots that is currently allocated
+ */
+inline std::vector<std::function<void()>>& get_input_slot_releasers()
+{
+    thread_local std::vector<std::function<void()>> releasers;
+    return releasers;
+}
+
+/**
+ * @brief The calling thread's heap-resident slot for decoding a T in place
+ *
+ * @details The rollup and kernel inputs run to hundreds of kilobytes, which as c_bind locals would take up a large part
+ * of the WASM stack (`-Wl,-z,stack-size` in `src/aztec3/CMakeLists.txt`) before the circuit itself runs. The sim
+ * c_binds instead `read` their inputs into the slot, over whatever the previous call on the thread left there, and
+ * hand the circuit a reference to it. The slot is allocated on first use and then reused, so a repeated call neither
+ * allocates nor copies the inputs. `release_input_slots` frees it again.
+ *
+ * Only use it with a `read` which sets every field of T, and only for one input at a time: the next decode into the
+ * same slot on the same thread overwrites it.
+ */
+template <typename T> T& get_input_slot()
+{
+    thread_local std::unique_ptr<T> slot;
+    if (!slot) {
+        slot = std::make_unique<T>();
+        get_input_slot_releasers().emplace_back([]() { slot.reset(); });
+    }
+    return *slot;
+}
+
+/**
+ * @brief Frees every input slot of the calling thread, invalidating any reference into them
+ * @details A slot keeps the largest input decoded into it for as long as its thread lives; this gives that memory
+ * back. The next `get_input_slot` allocates the slot afresh.
+ */
+inline void release_input_slots()
+{
+    auto& releasers = get_input_slot_releasers();
+    for (auto const& release : releasers) {
+        release();
+    }
+    releasers.clear();
+}
+
+}  // namespace aztec3::utils
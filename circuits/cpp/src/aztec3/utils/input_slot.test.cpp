@@ -0,0 +1,26 @@
+#include "input_slot.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <vector>
+
+namespace aztec3::utils {
+
+TEST(input_slot_tests, slot_is_reused_until_released)
+{
+    auto& slot = get_input_slot<std::vector<uint8_t>>();
+    slot.assign(1024, 1);
+    EXPECT_EQ(&get_input_slot<std::vector<uint8_t>>(), &slot);
+    EXPECT_EQ(get_input_slot<std::vector<uint8_t>>().size(), 1024U);
+
+    // releasing frees what the slot held, and the next use starts from a fresh one
+    release_input_slots();
+    EXPECT_TRUE(get_input_slot_releasers().empty());
+    EXPECT_TRUE(get_input_slot<std::vector<uint8_t>>().empty());
+    EXPECT_EQ(get_input_slot_releasers().size(), 1U);
+
+    release_input_slots();
+}
+
+}  // namespace aztec3::utils
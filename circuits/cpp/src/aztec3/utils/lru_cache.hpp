@@ -0,0 +1,156 @@
+#pragma once
+
+#include <barretenberg/barretenberg.hpp>
+
+#include <cstddef>
+#include <functional>
+#include <list>
+#include <optional>
+#include <unordered_map>
+#include <utility>
+#ifndef NO_MULTITHREADING
+#include <mutex>
+#endif
+
+namespace aztec3::utils {
+
+#ifdef NO_MULTITHREADING
+// Single threaded builds (e.g. WASM) may not have std::mutex, and have nothing to lock against anyway
+struct CacheMutex {};
+struct CacheLock {
+    explicit CacheLock(CacheMutex& /*unused*/) {}
+};
+#else
+using CacheMutex = std::mutex;
+using CacheLock = std::lock_guard<std::mutex>;
+#endif
+
+/**
+ * @brief Hit/miss counters of a cache
+ */
+struct CacheStats {
+    size_t hits = 0;
+    size_t misses = 0;
+    size_t size = 0;
+    size_t capacity = 0;
+
+    MSGPACK_FIELDS(hits, misses, size, capacity);
+    bool operator==(CacheStats const&) const = default;
+
+    /**
+     * @brief The fraction of lookups which were served from the cache
+     * @return hits / (hits + misses), or 0 if there has not been any lookup yet
+     */
+    [[nodiscard]] double hit_rate() const
+    {
+        size_t const lookups = hits + misses;
+        return lookups == 0 ? 0.0 : static_cast<double>(hits) / static_cast<double>(lookups);
+    }
+};
+
+/**
+ * @brief A bounded, thread-safe, least-recently-used cache
+ * @details Once `capacity` entries are held, inserting a new key evicts the entry which was looked up or inserted
+ * the longest time ago. A capacity of 0 disables caching (every lookup misses). All members may be called
+ * concurrently.
+ * @tparam Key the key type, hashed with `Hash` and compared with `operator==`
+ * @tparam Value the cached value type, returned by copy
+ * @tparam Hash the hash functor used to bucket the keys
+ */
+template <typename Key, typename Value, typename Hash = std::hash<Key>> class LruCache {
+  public:
+    explicit LruCache(size_t capacity) : capacity(capacity) {}
+
+    /**
+     * @brief Looks up a key, marking it as the most recently used entry on a hit
+     * @param key the key to look up
+     * @return the cached value, or nullopt on a miss
+     */
+    std::optional<Value> get(Key const& key)
+    {
+        CacheLock const lock(mutex);
+        auto const it = index.find(key);
+        if (it == index.end()) {
+            misses++;
+            return std::nullopt;
+        }
+        hits++;
+        entries.splice(entries.begin(), entries, it->second);
+        return it->second->second;
+    }
+
+    /**
+     * @brief Inserts (or overwrites) an entry as the most recently used one, evicting the least recently used entry
+     * if the cache is full
+     * @param key the key to insert
+     * @param value the value to cache against `key`
+     */
+    void put(Key const& key, Value const& value)
+    {
+        CacheLock const lock(mutex);
+        if (capacity == 0) {
+            return;
+        }
+        auto const it = index.find(key);
+        if (it != index.end()) {
+            it->second->second = value;
+            entries.splice(entries.begin(), entries, it->second);
+            return;
+        }
+        entries.emplace_front(key, value);
+        index.emplace(key, entries.begin());
+        if (entries.size() > capacity) {
+            index.erase(entries.back().first);
+            entries.pop_back();
+        }
+    }
+
+    /**
+     * @brief Returns the cached value of a key, computing and caching it on a miss
+     * @details `compute` runs without holding the lock, so concurrent misses do not serialise each other (two threads
+     * missing on the same key may both compute it).
+     * @param key the key to look up
+     * @param compute a callable `Value()` producing the value of `key`
+     * @return the value of `key`
+     */
+    template <typename Compute> Value get_or_compute(Key const& key, Compute const& compute)
+    {
+        if (auto cached = get(key)) {
+            return *cached;
+        }
+        Value value = compute();
+        put(key, value);
+        return value;
+    }
+
+    /**
+     * @brief Drops every entry and resets the hit/miss counters
+     */
+    void clear()
+    {
+        CacheLock const lock(mutex);
+        index.clear();
+        entries.clear();
+        hits = 0;
+        misses = 0;
+    }
+
+    [[nodiscard]] CacheStats stats()
+    {
+        CacheLock const lock(mutex);
+        return { .hits = hits, .misses = misses, .size = entries.size(), .capacity = capacity };
+    }
+
+  private:
+    using Entries = std::list<std::pair<Key, Value>>;
+
+    size_t capacity;
+    // most recently used first
+    Entries entries;
+    std::unordered_map<Key, typename Entries::iterator, Hash> index;
+    size_t hits = 0;
+    size_t misses = 0;
+    CacheMutex mutex;
+};
+
+}  // namespace aztec3::utils
@@ -0,0 +1,64 @@
+#pragma once
+#include "aztec3/utils/dummy_composer.hpp"
+
+#include <barretenberg/barretenberg.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+namespace aztec3::utils {
+
+/**
+ * @brief How a c_bind serializes its output: with `write`, or with `write_sparse` (which records runs of empty array
+ * items compactly)
+ */
+enum class OutputEncoding { DENSE, SPARSE };
+
+/**
+ * @brief Serializes `output` into a `malloc`ed buffer, which the host frees
+ * @param output what to serialize
+ * @param size_out set to the buffer's size
+ * @return the buffer
+ */
+template <OutputEncoding ENCODING = OutputEncoding::DENSE, typename Output>
+uint8_t* write_to_malloc_buffer(Output const& output, size_t* size_out)
+{
+    using serialize::write;
+
+    // serialize output to bytes vec
+    std::vector<uint8_t> output_vec;
+    if constexpr (ENCODING == OutputEncoding::SPARSE) {
+        write_sparse(output_vec, output);
+    } else {
+        write(output_vec, output);
+    }
+    // copy output to output buffer
+    auto* raw_output_buf = static_cast<uint8_t*>(malloc(output_vec.size()));
+    memcpy(raw_output_buf, output_vec.data(), output_vec.size());
+    *size_out = output_vec.size();
+    return raw_output_buf;
+}
+
+/**
+ * @brief Serializes a simulation's output into a `malloc`ed buffer, and its first failure (if any) into another, as
+ * the sim c_binds return them
+ * @param composer the composer the simulation ran with
+ * @param output the simulation's output (public inputs)
+ * @param output_size_out set to the serialized output's size
+ * @param output_buf_out set to the serialized output
+ * @return the serialized first failure, or nullptr if there was none
+ */
+template <OutputEncoding ENCODING = OutputEncoding::DENSE, typename Output>
+uint8_t* serialize_to_malloc_buffer(DummyComposer& composer,
+                                    Output const& output,
+                                    size_t* output_size_out,
+                                    uint8_t const** output_buf_out)
+{
+    *output_buf_out = write_to_malloc_buffer<ENCODING>(output, output_size_out);
+    return composer.alloc_and_serialize_first_failure();
+}
+
+}  // namespace aztec3::utils
@@ -0,0 +1,214 @@
+#pragma once
+#include "aztec3/utils/crs_factory.hpp"
+
+#include <barretenberg/barretenberg.hpp>
+#include <barretenberg/ecc/curves/bn254/scalar_multiplication/scalar_multiplication.hpp>
+#include <barretenberg/srs/factories/crs_factory.hpp>
+#include <barretenberg/srs/factories/file_crs_factory.hpp>
+#include <barretenberg/srs/io.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <utility>
+#ifndef __wasm__
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <filesystem>
+#include <fstream>
+#include <mutex>
+#include <vector>
+#endif
+
+namespace aztec3::utils {
+
+#ifndef __wasm__
+// WASM has no files to map, and keeps to barretenberg's CRS factory
+
+// "AZCR", followed by the format version and the number of points the table was prepared for
+constexpr uint32_t PREPARED_CRS_MAGIC = 0x415a4352;
+constexpr uint32_t PREPARED_CRS_FORMAT_VERSION = 1;
+// the table starts a cache line into the file, so that the mapped points are aligned
+constexpr size_t PREPARED_CRS_POINTS_OFFSET = 64;
+
+struct PreparedCrsHeader {
+    uint32_t magic = PREPARED_CRS_MAGIC;
+    uint32_t version = PREPARED_CRS_FORMAT_VERSION;
+    uint64_t num_points = 0;
+};
+
+/**
+ * @brief A prepared CRS file, mapped into memory for as long as any prover CRS handed out over it is alive
+ */
+class MappedPreparedCrs {
+  public:
+    MappedPreparedCrs(void* base, size_t length, size_t num_points)
+        : base(base)
+        , length(length)
+        , num_points(num_points)
+    {}
+    ~MappedPreparedCrs() { munmap(base, length); }
+
+    MappedPreparedCrs(MappedPreparedCrs const&) = delete;
+    MappedPreparedCrs(MappedPreparedCrs&&) = delete;
+    MappedPreparedCrs& operator=(MappedPreparedCrs const&) = delete;
+    MappedPreparedCrs& operator=(MappedPreparedCrs&&) = delete;
+
+    [[nodiscard]] barretenberg::g1::affine_element* points() const
+    {
+        return reinterpret_cast<barretenberg::g1::affine_element*>(static_cast<uint8_t*>(base) +
+                                                                    PREPARED_CRS_POINTS_OFFSET);
+    }
+
+    [[nodiscard]] size_t size() const { return num_points; }
+
+  private:
+    void* base;
+    size_t length;
+    size_t num_points;
+};
+
+class MmapProverCrs : public barretenberg::srs::factories::ProverCrs {
+  public:
+    MmapProverCrs(std::shared_ptr<MappedPreparedCrs> mapping, size_t degree)
+        : mapping(std::move(mapping))
+        , degree(degree)
+    {}
+
+    barretenberg::g1::affine_element* get_monomial_points() override { return mapping->points(); }
+
+    size_t get_monomial_size() const override { return degree; }
+
+  private:
+    std::shared_ptr<MappedPreparedCrs> mapping;
+    size_t degree;
+};
+
+/**
+ * @brief A CRS factory whose prover CRSs are memory-mapped from a prepared copy of the transcript's monomial points
+ *
+ * @details A prover does not use the transcript's points as they are stored, but as barretenberg's Pippenger point
+ * table: converted to Montgomery form, each followed by its endomorphism image. Barretenberg's own factories read
+ * and convert the points into every process's (and every factory's) own memory. This factory instead prepares the
+ * table once, into the file at `prepared_path`, and maps the file into memory copy-on-write:
+ * - a prover only faults in the pages of the points its circuit size needs, as the table of the first `n` points is
+ *   a prefix of the table of all of them;
+ * - the pages are the kernel's page cache of the file, so they are shared by every thread and every process (e.g.
+ *   several prover workers on one host) mapping it.
+ *
+ * The file is prepared for the largest degree asked for so far, and prepared again (from `transcript_dir`) when a
+ * larger one is asked for. It is replaced by renaming a complete file over it, so a process never maps a partly
+ * written table. The file holds the points in the host's in-memory layout: it is a cache for one host, not a format
+ * to share between machines. The verifier CRS (the G2 point) is small, and read from the transcript as usual.
+ */
+class MmapCrsFactory : public CrsFactory {
+  public:
+    MmapCrsFactory(std::string transcript_dir, std::string prepared_path)
+        : transcript_dir(std::move(transcript_dir))
+        , prepared_path(std::move(prepared_path))
+        , verifier_factory(this->transcript_dir)
+    {}
+
+    std::shared_ptr<barretenberg::srs::factories::ProverCrs> get_prover_crs(size_t degree) override
+    {
+        std::lock_guard<std::mutex> const lock(mutex);
+        if (!mapping || mapping->size() < degree) {
+            mapping = map_prepared_crs(degree);
+            if (!mapping) {
+                prepare_crs(degree);
+                mapping = map_prepared_crs(degree);
+            }
+        }
+        return std::make_shared<MmapProverCrs>(mapping, degree);
+    }
+
+    std::shared_ptr<barretenberg::srs::factories::VerifierCrs> get_verifier_crs() override
+    {
+        return verifier_factory.get_verifier_crs();
+    }
+
+  private:
+    static size_t table_size_in_bytes(size_t num_points)
+    {
+        // the Pippenger point table holds each point and its endomorphism image
+        return 2 * num_points * sizeof(barretenberg::g1::affine_element);
+    }
+
+    /**
+     * @return the prepared file mapped into memory, or nullptr if there is no complete one for at least `degree`
+     * points in this version of the format
+     */
+    [[nodiscard]] std::shared_ptr<MappedPreparedCrs> map_prepared_crs(size_t degree) const
+    {
+        int const fd = open(prepared_path.c_str(), O_RDONLY);
+        if (fd < 0) {
+            return nullptr;
+        }
+        PreparedCrsHeader header;
+        struct stat file_stat = {};
+        bool const valid = pread(fd, &header, sizeof(header), 0) == static_cast<ssize_t>(sizeof(header)) &&
+                           header.magic == PREPARED_CRS_MAGIC && header.version == PREPARED_CRS_FORMAT_VERSION &&
+                           header.num_points >= degree && fstat(fd, &file_stat) == 0 &&
+                           static_cast<size_t>(file_stat.st_size) ==
+                               PREPARED_CRS_POINTS_OFFSET + table_size_in_bytes(header.num_points);
+        if (!valid) {
+            close(fd);
+            return nullptr;
+        }
+
+        size_t const length = static_cast<size_t>(file_stat.st_size);
+        // private, so that a stray write can only ever touch this process's copy of a page
+        void* const base = mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+        // the mapping keeps the file open
+        close(fd);
+        if (base == MAP_FAILED) {
+            return nullptr;
+        }
+        return std::make_shared<MappedPreparedCrs>(base, length, header.num_points);
+    }
+
+    void prepare_crs(size_t degree) const
+    {
+        std::vector<barretenberg::g1::affine_element> table(2 * degree);
+        barretenberg::io::read_transcript_g1(table.data(), degree, transcript_dir);
+        barretenberg::scalar_multiplication::generate_pippenger_point_table(table.data(), table.data(), degree);
+
+        PreparedCrsHeader const header{ .num_points = degree };
+        std::vector<char> padded_header(PREPARED_CRS_POINTS_OFFSET, 0);
+        std::memcpy(padded_header.data(), &header, sizeof(header));
+
+        // written next to the prepared file, then renamed over it in one step
+        auto const partial_path = prepared_path + ".partial." + std::to_string(getpid());
+        {
+            std::ofstream file(partial_path, std::ios::binary | std::ios::trunc);
+            file.write(padded_header.data(), static_cast<std::streamsize>(padded_header.size()));
+            file.write(reinterpret_cast<char const*>(table.data()),
+                       static_cast<std::streamsize>(table_size_in_bytes(degree)));
+        }
+        std::filesystem::rename(partial_path, prepared_path);
+    }
+
+    std::string const transcript_dir;
+    std::string const prepared_path;
+    barretenberg::srs::factories::FileCrsFactory verifier_factory;
+
+    mutable std::mutex mutex;
+    std::shared_ptr<MappedPreparedCrs> mapping;
+};
+
+/**
+ * @brief Makes `get_crs_factory` hand out an `MmapCrsFactory` over the given transcript and prepared file
+ * @details Call it once, before any proving starts, as `init_crs_factory` is.
+ */
+inline void init_mmap_crs_factory(std::string const& transcript_dir, std::string const& prepared_path)
+{
+    get_crs_factory_slot() = std::make_shared<MmapCrsFactory>(transcript_dir, prepared_path);
+}
+#endif
+
+}  // namespace aztec3::utils
@@ -0,0 +1,100 @@
+#pragma once
+#include "aztec3/utils/circuit_errors.hpp"
+#include "aztec3/utils/dummy_composer.hpp"
+
+#include <barretenberg/barretenberg.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace aztec3::utils {
+
+/**
+ * @brief A growable buffer which c_binds serialize their outputs straight into, in place of a `std::vector` per output
+ * which is then copied into a `malloc`ed buffer of its own
+ *
+ * @details Every `*_scratch` c_bind starts by `reset`ting the calling thread's arena and hands the host pointers into
+ * it, so those pointers stay valid until the next `*_scratch` call on the same thread or until the host calls
+ * `scratch_arena__release`. The host must copy out anything it wants to keep and never `free` them.
+ *
+ * `reset` keeps the buffer's capacity, so once the arena has grown to fit a c_bind's outputs every later call writes
+ * them in place: one serialization, no allocation and no copy.
+ */
+class ScratchArena {
+  public:
+    /**
+     * @brief Starts over, invalidating every pointer into the arena but keeping its capacity
+     */
+    void reset() { buffer.clear(); }
+
+    /**
+     * @brief Frees the arena's memory
+     */
+    void release() { std::vector<uint8_t>().swap(buffer); }
+
+    /**
+     * @brief Serializes `value` at the end of the arena
+     * @return the offset it was written at, see `at` (pointers are only stable once all outputs are written)
+     */
+    template <typename T> size_t write(T const& value)
+    {
+        using serialize::write;
+
+        size_t const offset = buffer.size();
+        write(buffer, value);
+        return offset;
+    }
+
+    [[nodiscard]] uint8_t const* at(size_t offset) const { return buffer.data() + offset; }
+
+    [[nodiscard]] size_t size() const { return buffer.size(); }
+
+  private:
+    std::vector<uint8_t> buffer;
+};
+
+/**
+ * @brief The calling thread's scratch arena
+ */
+inline ScratchArena& get_scratch_arena()
+{
+    thread_local ScratchArena arena;
+    return arena;
+}
+
+/**
+ * @brief Serializes a simulation's output, and its first failure if any, into the calling thread's scratch arena
+ * @details The scratch arena counterpart of `serialize_to_malloc_buffer`.
+ * @param composer the composer the simulation ran with
+ * @param output the simulation's output (public inputs)
+ * @param output_size_out set to the serialized output's size
+ * @param output_buf_out set to the serialized output, in the arena
+ * @return the serialized first failure, in the arena, or nullptr if there was none
+ */
+template <typename Output>
+uint8_t const* serialize_to_scratch_arena(DummyComposer& composer,
+                                          Output const& output,
+                                          size_t* output_size_out,
+                                          uint8_t const** output_buf_out)
+{
+    ScratchArena& arena = get_scratch_arena();
+    arena.reset();
+
+    size_t const output_offset = arena.write(output);
+    *output_size_out = arena.size() - output_offset;
+
+    CircuitError const failure = composer.get_first_failure();
+    bool const failed = failure.code != CircuitErrorCode::NO_ERROR;
+    size_t failure_offset = 0;
+    if (failed) {
+        info(composer.method_name, ": composer.get_first_failure() = ", failure);
+        failure_offset = arena.write(failure);
+    }
+
+    // only now that nothing more is written (so the arena cannot reallocate) are the pointers taken
+    *output_buf_out = arena.at(output_offset);
+    return failed ? arena.at(failure_offset) : nullptr;
+}
+
+}  // namespace aztec3::utils
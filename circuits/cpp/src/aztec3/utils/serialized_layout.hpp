@@ -0,0 +1,104 @@
+#pragma once
+#include "./types/native_types.hpp"
+
+#include <barretenberg/barretenberg.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+namespace aztec3::utils {
+
+using NT = types::NativeTypes;
+
+/**
+ * @brief The number of bytes `write` produces for every value of type T, for the types whose serialized form has a
+ * fixed length (no length prefixes, no optional parts)
+ *
+ * @details Defines `value` only for such types, see `HasFixedSerializedSize`. Fixed-length arrays of them are covered
+ * here, and the fixed-layout ABI structs in `aztec3/circuits/abis/serialized_layouts.hpp`.
+ */
+template <typename T> struct FixedSerializedSize {};
+
+template <> struct FixedSerializedSize<bool> : std::integral_constant<size_t, 1> {};
+template <> struct FixedSerializedSize<uint8_t> : std::integral_constant<size_t, 1> {};
+template <> struct FixedSerializedSize<uint32_t> : std::integral_constant<size_t, 4> {};
+template <> struct FixedSerializedSize<uint64_t> : std::integral_constant<size_t, 8> {};
+template <> struct FixedSerializedSize<NT::fr> : std::integral_constant<size_t, 32> {};
+template <> struct FixedSerializedSize<NT::address> : std::integral_constant<size_t, 32> {};
+template <> struct FixedSerializedSize<NT::grumpkin_point> : std::integral_constant<size_t, 64> {};
+
+template <typename T>
+concept HasFixedSerializedSize = requires { FixedSerializedSize<T>::value; };
+
+template <HasFixedSerializedSize T, size_t N>
+struct FixedSerializedSize<std::array<T, N>> : std::integral_constant<size_t, N * FixedSerializedSize<T>::value> {};
+
+template <HasFixedSerializedSize T> constexpr size_t fixed_serialized_size = FixedSerializedSize<T>::value;
+
+/**
+ * @brief The serialized layout of a struct whose fields (in `read`/`write` order) all have a fixed serialized size
+ * @tparam Fields the field types, in the order the struct's `read` reads them
+ */
+template <HasFixedSerializedSize... Fields> struct FixedSerializedLayout {
+    static constexpr std::array<size_t, sizeof...(Fields)> field_sizes = { fixed_serialized_size<Fields>... };
+
+    static constexpr size_t size = (fixed_serialized_size<Fields> + ... + 0);
+
+    /**
+     * @brief The byte offset of the `index`th field from the start of the struct
+     */
+    static constexpr size_t offset(size_t index)
+    {
+        size_t result = 0;
+        for (size_t i = 0; i < index; i++) {
+            result += field_sizes[i];
+        }
+        return result;
+    }
+};
+
+template <typename T> struct IsStdVector : std::false_type {};
+template <typename T> struct IsStdVector<std::vector<T>> : std::true_type {};
+
+// a length-prefixed vector of fixed-size items
+template <typename T>
+concept IsFixedSizeItemVector = IsStdVector<T>::value && HasFixedSerializedSize<typename T::value_type>;
+
+/**
+ * @brief Advances `it` past a serialized T, decoding as little of it as possible
+ * @details Fixed-size values (and vectors of them) are stepped over without being decoded. Anything else is read
+ * into a temporary and dropped.
+ */
+template <typename T> void skip_serialized(uint8_t const*& it)
+{
+    using serialize::read;
+
+    if constexpr (HasFixedSerializedSize<T>) {
+        it += fixed_serialized_size<T>;
+    } else if constexpr (IsFixedSizeItemVector<T>) {
+        uint32_t size = 0;
+        read(it, size);
+        it += size * fixed_serialized_size<typename T::value_type>;
+    } else {
+        T discarded;
+        read(it, discarded);
+    }
+}
+
+/**
+ * @brief Reads a T from `offset` bytes into `data`
+ */
+template <typename T> T read_at(uint8_t const* data, size_t offset)
+{
+    using serialize::read;
+
+    T value;
+    uint8_t const* it = data + offset;
+    read(it, value);
+    return value;
+}
+
+}  // namespace aztec3::utils
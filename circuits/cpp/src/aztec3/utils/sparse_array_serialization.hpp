@@ -0,0 +1,71 @@
+#pragma once
+
+#include <barretenberg/barretenberg.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace aztec3::utils {
+
+/**
+ * @brief Writes a fixed-size array in the sparse encoding: alternating runs of empty and non-empty items
+ *
+ * @details An item is empty when it equals a default-constructed `T`, which is what every unused slot of the kernel's
+ * fixed-size arrays holds. The array is written as a sequence of runs, each a `uint32` count of empty items, a
+ * `uint32` count of non-empty items, and then those non-empty items as `write` writes them. The runs cover the whole
+ * array, so an empty array costs one run of 8 bytes whatever its size.
+ *
+ * `read_sparse_array` restores exactly the array that was written.
+ */
+template <typename T, size_t SIZE> void write_sparse_array(std::vector<uint8_t>& buf, std::array<T, SIZE> const& arr)
+{
+    using serialize::write;
+
+    T const empty{};
+    size_t i = 0;
+    while (i < SIZE) {
+        size_t const empty_start = i;
+        while (i < SIZE && arr[i] == empty) {
+            ++i;
+        }
+        size_t const items_start = i;
+        while (i < SIZE && !(arr[i] == empty)) {
+            ++i;
+        }
+        write(buf, static_cast<uint32_t>(items_start - empty_start));
+        write(buf, static_cast<uint32_t>(i - items_start));
+        for (size_t j = items_start; j < i; ++j) {
+            write(buf, arr[j]);
+        }
+    }
+}
+
+/**
+ * @brief Reads a fixed-size array written by `write_sparse_array`
+ */
+template <typename T, size_t SIZE> void read_sparse_array(uint8_t const*& it, std::array<T, SIZE>& arr)
+{
+    using serialize::read;
+
+    size_t i = 0;
+    while (i < SIZE) {
+        uint32_t num_empty = 0;
+        uint32_t num_items = 0;
+        read(it, num_empty);
+        read(it, num_items);
+        size_t const run_length = size_t{ num_empty } + num_items;
+        if (run_length == 0 || i + run_length > SIZE) {
+            throw_or_abort("read_sparse_array: malformed run");
+        }
+        for (size_t j = 0; j < num_empty; ++j) {
+            arr[i++] = T{};
+        }
+        for (size_t j = 0; j < num_items; ++j) {
+            read(it, arr[i++]);
+        }
+    }
+}
+
+}  // namespace aztec3::utils
@@ -0,0 +1,87 @@
+#pragma once
+#include "aztec3/utils/crs_factory.hpp"
+
+#include <barretenberg/srs/factories/crs_factory.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <utility>
+
+namespace aztec3::utils {
+
+/**
+ * @brief The first `degree` points of a larger prover CRS
+ */
+class PrefixProverCrs : public barretenberg::srs::factories::ProverCrs {
+  public:
+    PrefixProverCrs(std::shared_ptr<barretenberg::srs::factories::ProverCrs> crs, size_t degree)
+        : crs(std::move(crs))
+        , degree(degree)
+    {}
+
+    barretenberg::g1::affine_element* get_monomial_points() override { return crs->get_monomial_points(); }
+
+    size_t get_monomial_size() const override { return degree; }
+
+  private:
+    std::shared_ptr<barretenberg::srs::factories::ProverCrs> crs;
+    size_t degree;
+};
+
+/**
+ * @brief A CRS factory which may be asked for CRSs from several threads at once, over one which may not
+ *
+ * @details Barretenberg's file factory loads a prover CRS when asked for a degree other than the last one it loaded,
+ * replacing that one without a lock, so provers of different circuit sizes running at once race on it. This factory
+ * asks the wrapped one under a lock, and only for a degree larger than any it has had: a smaller one is handed out as
+ * a prefix of the largest (the Pippenger point table of the first `n` points is a prefix of the table of all of them).
+ */
+class ThreadSafeCrsFactory : public CrsFactory {
+  public:
+    explicit ThreadSafeCrsFactory(std::shared_ptr<CrsFactory> factory)
+        : factory(std::move(factory))
+    {}
+
+    std::shared_ptr<barretenberg::srs::factories::ProverCrs> get_prover_crs(size_t degree) override
+    {
+        std::lock_guard<std::mutex> const lock(mutex);
+        if (!largest_prover_crs || largest_prover_crs->get_monomial_size() < degree) {
+            largest_prover_crs = factory->get_prover_crs(degree);
+        }
+        return std::make_shared<PrefixProverCrs>(largest_prover_crs, degree);
+    }
+
+    std::shared_ptr<barretenberg::srs::factories::VerifierCrs> get_verifier_crs() override
+    {
+        std::lock_guard<std::mutex> const lock(mutex);
+        if (!verifier_crs) {
+            verifier_crs = factory->get_verifier_crs();
+        }
+        return verifier_crs;
+    }
+
+  private:
+    std::shared_ptr<CrsFactory> const factory;
+
+    std::mutex mutex;
+    std::shared_ptr<barretenberg::srs::factories::ProverCrs> largest_prover_crs;
+    std::shared_ptr<barretenberg::srs::factories::VerifierCrs> verifier_crs;
+};
+
+/**
+ * @brief Makes `get_crs_factory` hand out a `ThreadSafeCrsFactory` over the factory it hands out now, unless it already
+ * does
+ * @details Call it after the CRS is initialised (`init_crs_factory` or `init_mmap_crs_factory`), and before any
+ * concurrent proving starts.
+ */
+inline void init_thread_safe_crs_factory()
+{
+    auto& slot = get_crs_factory_slot();
+    auto factory = get_crs_factory();
+    if (factory != nullptr && std::dynamic_pointer_cast<ThreadSafeCrsFactory>(factory) == nullptr) {
+        slot = std::make_shared<ThreadSafeCrsFactory>(std::move(factory));
+    }
+}
+
+}  // namespace aztec3::utils
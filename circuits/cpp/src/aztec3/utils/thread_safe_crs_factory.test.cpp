@@ -0,0 +1,64 @@
+#include "thread_safe_crs_factory.hpp"
+
+#include <barretenberg/barretenberg.hpp>
+#include <barretenberg/srs/factories/file_crs_factory.hpp>
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace {
+
+constexpr char const* TRANSCRIPT_DIR = "../barretenberg/cpp/srs_db/ignition";
+
+}  // namespace
+
+namespace aztec3::utils {
+
+TEST(thread_safe_crs_factory_tests, smaller_degrees_are_prefixes_of_the_largest)
+{
+    ThreadSafeCrsFactory factory(std::make_shared<barretenberg::srs::factories::FileCrsFactory>(TRANSCRIPT_DIR));
+    barretenberg::srs::factories::FileCrsFactory file_factory(TRANSCRIPT_DIR);
+
+    auto large_crs = factory.get_prover_crs(2048);
+    auto small_crs = factory.get_prover_crs(512);
+    EXPECT_EQ(large_crs->get_monomial_size(), 2048U);
+    EXPECT_EQ(small_crs->get_monomial_size(), 512U);
+    EXPECT_EQ(small_crs->get_monomial_points(), large_crs->get_monomial_points());
+
+    auto file_crs = file_factory.get_prover_crs(512);
+    // each point and its endomorphism image
+    for (size_t i = 0; i < 2 * 512; i++) {
+        EXPECT_EQ(small_crs->get_monomial_points()[i], file_crs->get_monomial_points()[i]);
+    }
+}
+
+#ifndef NO_MULTITHREADING
+TEST(thread_safe_crs_factory_tests, concurrent_degrees_are_all_served)
+{
+    ThreadSafeCrsFactory factory(std::make_shared<barretenberg::srs::factories::FileCrsFactory>(TRANSCRIPT_DIR));
+    barretenberg::srs::factories::FileCrsFactory file_factory(TRANSCRIPT_DIR);
+    auto const first_point = file_factory.get_prover_crs(512)->get_monomial_points()[0];
+
+    constexpr std::array<size_t, 4> degrees = { 512, 4096, 1024, 2048 };
+    std::array<std::shared_ptr<barretenberg::srs::factories::ProverCrs>, degrees.size()> crss;
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < degrees.size(); i++) {
+        threads.emplace_back([&, i]() { crss[i] = factory.get_prover_crs(degrees[i]); });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    for (size_t i = 0; i < degrees.size(); i++) {
+        EXPECT_EQ(crss[i]->get_monomial_size(), degrees[i]);
+        EXPECT_EQ(crss[i]->get_monomial_points()[0], first_point);
+    }
+}
+#endif
+
+}  // namespace aztec3::utils